@@ -0,0 +1,94 @@
+#include "astro.h"
+#include <math.h>
+
+static constexpr double J2000 = 2451545.0;     // Julian date of 2000-01-01 12:00 UTC
+static constexpr double UNIX_EPOCH = 2440587.5; // Julian date of 1970-01-01 00:00 UTC
+
+//=============== SUN ===============
+// Sunrise equation with the low order terms of the solar orbit
+static constexpr double SUN_MEAN_ANOMALY[2] = {357.5291, 0.98560028}; // degrees, degrees per day
+static constexpr double SUN_CENTER[3] = {1.9148, 0.0200, 0.0003};    // equation of center, sin(M), sin(2M), sin(3M)
+static constexpr double SUN_PERIHELION = 102.9372;                    // argument of perihelion, degrees
+static constexpr double SUN_TRANSIT[2] = {0.0053, -0.0069};           // equation of time, sin(M), sin(2L) in days
+static constexpr double EARTH_TILT = 23.4397;                         // obliquity of the ecliptic, degrees
+static constexpr double SUN_HORIZON = -0.833;                         // refraction and solar disc radius, degrees
+
+//=============== MOON ===============
+// Low precision phase angle from the mean elongation plus its largest
+// periodic terms (Meeus, Astronomical Algorithms, ch. 48)
+static constexpr double MOON_ELONGATION[2] = {297.8501921, 445267.1114034}; // D, degrees and degrees per century
+static constexpr double MOON_SUN_ANOMALY[2] = {357.5291092, 35999.0502909}; // M
+static constexpr double MOON_ANOMALY[2] = {134.9633964, 477198.8675055};    // M'
+
+struct MoonTerm
+{
+    float coef;      // degrees
+    int8_t d, m, mp; // multiples of D, M and M'
+};
+
+static constexpr MoonTerm MOON_TERMS[] = {
+    {6.289, 0, 0, 1},
+    {-2.100, 0, 1, 0},
+    {1.274, 2, 0, -1},
+    {0.658, 2, 0, 0},
+    {0.214, 0, 0, 2},
+    {0.110, 1, 0, 0},
+};
+
+// Days from 2000-01-01 to the given date
+static long daysSince2000(uint16_t year, uint8_t month, uint8_t day)
+{
+    static const uint16_t monthStart[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+    long days = 365L * (year - 2000) + (year - 1997) / 4 - (year - 1901) / 100 + (year - 1601) / 400;
+    days += monthStart[month - 1] + day - 1;
+    if (month > 2 && year % 4 == 0 && (year % 100 != 0 || year % 400 == 0))
+        days++;
+    return days;
+}
+
+static double normalize(double deg)
+{
+    deg = fmod(deg, 360.0);
+    return deg < 0 ? deg + 360.0 : deg;
+}
+
+bool astroSunTimes(uint16_t year, uint8_t month, uint8_t day, float lat, float lon, uint32_t &rise, uint32_t &set)
+{
+    rise = set = 0;
+
+    // Mean solar noon at this longitude, days since J2000
+    double n = daysSince2000(year, month, day) - lon / 360.0;
+
+    double m = normalize(SUN_MEAN_ANOMALY[0] + SUN_MEAN_ANOMALY[1] * n) * DEG_TO_RAD;
+    double c = SUN_CENTER[0] * sin(m) + SUN_CENTER[1] * sin(2 * m) + SUN_CENTER[2] * sin(3 * m);
+    double l = normalize(m / DEG_TO_RAD + c + 180.0 + SUN_PERIHELION) * DEG_TO_RAD; // ecliptic longitude
+    double transit = n + SUN_TRANSIT[0] * sin(m) + SUN_TRANSIT[1] * sin(2 * l);
+
+    double sinDecl = sin(l) * sin(EARTH_TILT * DEG_TO_RAD);
+    double cosDecl = cos(asin(sinDecl));
+    double phi = lat * DEG_TO_RAD;
+    double cosHour = (sin(SUN_HORIZON * DEG_TO_RAD) - sin(phi) * sinDecl) / (cos(phi) * cosDecl);
+    if (cosHour < -1.0 || cosHour > 1.0)
+        return false;
+
+    double halfDay = acos(cosHour) / (2 * M_PI); // fraction of a day from transit to rise or set
+    rise = (uint32_t)((transit - halfDay + J2000 - UNIX_EPOCH) * 86400.0 + 0.5);
+    set = (uint32_t)((transit + halfDay + J2000 - UNIX_EPOCH) * 86400.0 + 0.5);
+    return true;
+}
+
+float astroMoonPhase(uint32_t utc)
+{
+    double t = (utc / 86400.0 + UNIX_EPOCH - J2000) / 36525.0; // Julian centuries since J2000
+
+    double d = normalize(MOON_ELONGATION[0] + MOON_ELONGATION[1] * t) * DEG_TO_RAD;
+    double m = normalize(MOON_SUN_ANOMALY[0] + MOON_SUN_ANOMALY[1] * t) * DEG_TO_RAD;
+    double mp = normalize(MOON_ANOMALY[0] + MOON_ANOMALY[1] * t) * DEG_TO_RAD;
+
+    // Elongation of the moon from the sun, 0 at new moon and 180 at full moon
+    double elong = d / DEG_TO_RAD;
+    for (const MoonTerm &term : MOON_TERMS)
+        elong += term.coef * sin(term.d * d + term.m * m + term.mp * mp);
+
+    return normalize(elong) / 360.0;
+}
@@ -0,0 +1,36 @@
+#ifndef ASTRO_H
+#define ASTRO_H
+
+// Sunrise, sunset and moon phase computed on the device from the location
+// and the RTC date, so the One Call request no longer needs the daily block
+// and the widgets keep working while WiFi is off. Accuracy is about a minute
+// for the sun, two or three near the polar circles where it meets the horizon
+// at a shallow angle, and a few hours for the moon, plenty for an HH:MM label
+// and a phase icon (checked against almanac times by tools/astro_check.cpp).
+
+#include <stdint.h>
+#ifdef ARDUINO
+#include <Arduino.h> // DEG_TO_RAD, the tools define their own
+#endif
+
+/**
+ * @brief Sunrise and sunset for a calendar day
+ * @param year Local date
+ * @param month 1-12
+ * @param day 1-31
+ * @param lat Latitude in degrees, north positive
+ * @param lon Longitude in degrees, east positive
+ * @param rise Set to the sunrise, UTC epoch
+ * @param set Set to the sunset, UTC epoch
+ * @return bool false on polar day or night, rise and set are 0 then
+ */
+bool astroSunTimes(uint16_t year, uint8_t month, uint8_t day, float lat, float lon, uint32_t &rise, uint32_t &set);
+
+/**
+ * @brief Moon phase at a point in time
+ * @param utc UTC epoch
+ * @return float 0 new moon, 0.25 first quarter, 0.5 full moon, 0.75 last quarter (same scale as OpenWeatherMap moon_phase)
+ */
+float astroMoonPhase(uint32_t utc);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+// CRC-32 (IEEE 802.3, reflected), the one of zlib.crc32 and the gzip trailer.
+// Incremental, start with 0 and feed the data in any number of pieces. A
+// nibble table keeps it at 64 bytes of flash and two lookups per byte.
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Adds bytes to a CRC-32
+ * @param crc CRC of the data so far, 0 for none
+ * @return uint32_t CRC of the data so far and these bytes
+ */
+inline uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len)
+{
+    static const uint32_t nibbles[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *data++;
+        crc = (crc >> 4) ^ nibbles[crc & 15];
+        crc = (crc >> 4) ^ nibbles[crc & 15];
+    }
+    return ~crc;
+}
+
+#endif
@@ -0,0 +1,44 @@
+#include "custom_record.h"
+#include <math.h>
+#include <string.h>
+#include "crc32.h"
+
+static const uint8_t magic[4] = {'W', 'C', 'R', '1'};
+
+static uint32_t readLe(const uint8_t *p, uint8_t bytes)
+{
+    uint32_t v = 0;
+    for (uint8_t i = 0; i < bytes; i++)
+        v |= (uint32_t)p[i] << (8 * i);
+    return v;
+}
+
+static void writeLe(uint8_t *p, uint32_t v, uint8_t bytes)
+{
+    for (uint8_t i = 0; i < bytes; i++)
+        p[i] = v >> (8 * i);
+}
+
+bool customRecordDecode(const uint8_t *rec, size_t len, WeatherSnapshot &weather)
+{
+    if (len != CUSTOM_RECORD_SIZE || memcmp(rec, magic, sizeof(magic)) != 0 || rec[4] != CUSTOM_RECORD_VERSION)
+        return false;
+    if (readLe(rec + 14, 4) != crc32Update(0, rec, 14))
+        return false;
+
+    weather.outdoorTemp = (int16_t)readLe(rec + 6, 2) / 100.0;
+    weather.outdoorHum = readLe(rec + 8, 2) / 100.0;
+    weather.outdoorPres = readLe(rec + 10, 4) / 100.0;
+    return true;
+}
+
+void customRecordEncode(float temp, float humidity, float pressure, uint8_t *rec)
+{
+    memcpy(rec, magic, sizeof(magic));
+    rec[4] = CUSTOM_RECORD_VERSION;
+    rec[5] = 0;
+    writeLe(rec + 6, (uint16_t)(int16_t)lroundf(temp * 100), 2);
+    writeLe(rec + 8, (uint16_t)lroundf(humidity * 100), 2);
+    writeLe(rec + 10, (uint32_t)lroundf(pressure * 100), 4);
+    writeLe(rec + 14, crc32Update(0, rec, 14), 4);
+}
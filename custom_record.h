@@ -0,0 +1,43 @@
+#ifndef CUSTOM_RECORD_H
+#define CUSTOM_RECORD_H
+
+// Compact binary reply of the custom weather server, asked for with
+// format=bin. Fixed layout, little endian, no padding:
+//
+//   offset size field
+//        0    4 magic "WCR1"
+//        4    1 version, CUSTOM_RECORD_VERSION
+//        5    1 flags, reserved, 0
+//        6    2 temperature, int16, 0.01 degC
+//        8    2 humidity, uint16, 0.01 %
+//       10    4 pressure, uint32, 0.01 hPa
+//       14    4 CRC-32 of bytes 0-13 (IEEE, same as zlib.crc32)
+//
+// customRecordEncode() is the reference for the server side.
+
+#include <stddef.h>
+#include <stdint.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include "snapshot.h"
+
+#define CUSTOM_RECORD_SIZE 18
+#define CUSTOM_RECORD_VERSION 1
+
+/**
+ * @brief Checks a record and copies its readings into the snapshot
+ * @param rec Received bytes
+ * @param len Number of bytes received
+ * @param weather outdoorTemp, outdoorHum and outdoorPres are set
+ * @return bool false on wrong size, magic, version or CRC, weather is untouched then
+ */
+bool customRecordDecode(const uint8_t *rec, size_t len, WeatherSnapshot &weather);
+
+/**
+ * @brief Builds a record, reference for the server implementation
+ * @param rec Output, CUSTOM_RECORD_SIZE bytes
+ */
+void customRecordEncode(float temp, float humidity, float pressure, uint8_t *rec);
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef DIRTY_REGION_H
+#define DIRTY_REGION_H
+
+// Regions of the weather layout and the choice of the partial refresh window.
+// Panels with fast partial update only redraw the regions whose hash changed,
+// merged into one window so the frame is rendered and refreshed once. Kept
+// free of the display libraries so tools/dirty_check.cpp can run it on the PC.
+
+#include <stdint.h>
+
+struct LayoutRect
+{
+    int16_t x, y;
+    uint16_t w, h;
+};
+
+// Regions of the weather layout, panels with fast partial update only redraw the ones that changed
+enum Widget : uint8_t
+{
+    WIDGET_STATUS,  // battery, last update time, wifi icon
+    WIDGET_ALERT,   // alert line under the status bar
+    WIDGET_DATE,    // day, month and weekday
+    WIDGET_INDOOR,  // main temperature
+    WIDGET_ENV,     // humidity, H/L, pressure and the separator lines
+    WIDGET_OUTDOOR, // outdoor block left of the first divider
+    WIDGET_SUN,     // sunrise and sunset row
+    WIDGET_ICON,    // weather icon and description
+    WIDGET_MOON,    // moon phase
+    WIDGET_COUNT
+};
+
+/**
+ * @brief Bounding box of the regions that changed since the frame on the panel
+ * @param boxes One box per region
+ * @param hashes Region hashes of the new frame
+ * @param shown Region hashes of the frame on the panel
+ * @param count Number of regions
+ * @param window Set to the box around every changed region, untouched when none changed
+ * @return bool false when no region changed, there is nothing to refresh
+ */
+inline bool dirtyWindow(const LayoutRect *boxes, const uint32_t *hashes, const uint32_t *shown, uint8_t count,
+                        LayoutRect &window)
+{
+    int32_t x0 = INT32_MAX, y0 = INT32_MAX, x1 = INT32_MIN, y1 = INT32_MIN;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (hashes[i] == shown[i])
+            continue;
+        const LayoutRect &box = boxes[i];
+        x0 = box.x < x0 ? box.x : x0;
+        y0 = box.y < y0 ? box.y : y0;
+        x1 = box.x + box.w > x1 ? box.x + box.w : x1;
+        y1 = box.y + box.h > y1 ? box.y + box.h : y1;
+    }
+    if (x1 < x0)
+        return false;
+    window = {(int16_t)x0, (int16_t)y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0)};
+    return true;
+}
+
+#endif
@@ -24,34 +24,23 @@ Copyright (C) 2024 desiFish
 // Enable/disable GxEPD2_GFX base class - uses ~1.2k more code
 #define ENABLE_GxEPD2_GFX 0
 
-#include <GxEPD2_3C.h> // 3-color e-paper display
+#include "hal.h"   // panel, sensors, RTC, ADC, WiFi, HTTP and NVS access
 #include <Fonts/FreeMonoBold9pt7b.h>
 #include <U8g2_for_Adafruit_GFX.h> // Include U8g2 fonts
-#include <Wire.h>                  // Used to establish serial communication on the I2C bus
-#include <SparkFun_TMP117.h>       // TMP117 temperature sensor library
-#include <Adafruit_Sensor.h>       // Adafruit sensor library
-#include "Adafruit_BME680.h"       // BME680 environmental sensor library
-#include <NTPClient.h>
-#include <WiFiUdp.h>
-#include "RTClib.h" // RTC library
-#include "image.h"  //for sleep icon
-#include <WiFi.h>
-#include <HTTPClient.h>
-#include <Arduino_JSON.h>
-#include <BH1750.h>  // Light sensor library
-#include <TimeLib.h> // for time functions
+#include "perf.h"  // wake cycle phase timing
+#include "ghost.h" // ghosting scheduler
+#include "snapshot.h"
+#include "astro.h" // sunrise, sunset and moon phase
+#include "hash.h"  // frame fingerprint
+#include "image.h" // wifi and network icons
+#include "packed_images.h" // sleep and alert screens packed by tools/pack_images.cpp
+#include "json_stream.h" // for parsing the API responses while they arrive
+#include "custom_record.h" // binary reply of the custom server
 #include "icons.h"   // for weather icons
+#include "layout.h"  // positions and fonts of the screens
+#include "icon_sprites.h" // weather icons rasterized by tools/icon_sprites.cpp
 
 #include <Arduino.h>
-#include <ESPAsyncWebServer.h> // for web server
-#include <AsyncTCP.h>          // for tcp connection
-#include <Preferences.h>       // for storing data in flash memory
-#include <esp_wifi.h>          // Add this with other includes at the top
-
-//=============== GLOBAL OBJECTS =================
-Preferences pref;
-// Create AsyncWebServer object on port 80
-AsyncWebServer server(80);
 
 //=============== HTML CODE =================
 const char index_html[] PROGMEM = R"rawliteral(
@@ -195,20 +184,44 @@ button {
 </html>
 )rawliteral";
 
-// Search for parameter in HTTP POST request
-const char *PARAM_INPUT_1 = "ssid";
-const char *PARAM_INPUT_2 = "pass";
-
 // your wifi name and password
 String ssid;
 String password;
 
-WiFiUDP ntpUDP;
-NTPClient timeClient(ntpUDP, "asia.pool.ntp.org", 19800); // 19800 is offset of India, asia.pool.ntp.org is close to India
-
-// save number of boots
-RTC_DATA_ATTR int bootCount = 0; // Persistent boot counter stored in RTC memory
-const byte ghostProtek = 2;      // ghost protection, 2 means for every 2 boots, 1 boot will be in dark mode
+#define UTC_OFFSET 19800                 // seconds east of UTC, 19800 is offset of India
+#define NTP_SERVER "asia.pool.ntp.org" // close to India
+
+// ghost protection, an inverted frame once the accumulated ghosting risk crosses the threshold
+// (with 15 min wakes and the usual weather, a clean cycle every 5 h or so instead of every other frame)
+const GhostPolicy ghostPolicy = {
+    200,  // threshold
+    1,    // fullRisk
+    2,    // partialRisk
+    3600, // staticStep, a point per static hour
+    6,    // maxTileRisk
+    4,    // minRefreshes
+    96,   // maxRefreshes, at least once a day with 15 min wakes
+};
+
+// last fetched weather, wakes inside the TTL draw it without starting WiFi
+RTC_DATA_ATTR WeatherSnapshot cachedWeather;
+RTC_DATA_ATTR uint32_t owmFetchedAt = 0;    // RTC unixtime of the last One Call response, 0 = never
+RTC_DATA_ATTR uint32_t customFetchedAt = 0; // RTC unixtime of the last custom server response
+RTC_DATA_ATTR HttpValidators owmValidators;    // ETag/Last-Modified matching cachedWeather
+RTC_DATA_ATTR HttpValidators customValidators;
+
+// fingerprint of the frame on the panel, an identical frame is not refreshed again
+RTC_DATA_ATTR uint32_t lastFrameHash = 0; // 0 when the panel shows something else (night, debug)
+RTC_DATA_ATTR byte skippedFrames = 0;     // refreshes skipped since the last one
+const byte maxSkippedFrames = 8;          // refresh anyway after this many skips, keeps the panel from fading
+
+// regions of the weather layout (PanelLayouts::widgets) redrawn on panels with fast partial update
+RTC_DATA_ATTR uint32_t widgetHashes[WIDGET_COUNT]; // content of each region on the panel
+RTC_DATA_ATTR bool widgetsOnPanel = false;          // false when the panel shows another layout or an inverted frame
+RTC_DATA_ATTR byte partialRefreshes = 0;            // partial updates since the last full refresh
+const byte fullRefreshEvery = 10;                   // full refresh after this many partial ones, clears ghosting
+const uint32_t OWM_TTL = 60 * 60;           // seconds One Call data is reused
+const uint32_t CUSTOM_TTL = 15 * 60;        // seconds the custom server data is reused
 
 // openWeatherMap Api Key from your profile in account section
 String openWeatherMapApiKey = ""; // add your profile key here when running for the first time
@@ -220,21 +233,11 @@ String customApiKey = ""; // add your api key here when running for the first ti
 String lat = "22.5895515";
 String lon = "88.2876455";
 
-RTC_DS3231 rtc; // Initalize rtc
-
-TMP117 sensor;           // Initalize temperature sensor
-Adafruit_BME680 bme;     // Initalize environmental sensor
-BH1750 lightMeter(0x23); // Initalize light sensor
-
 // Initalize display
-GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> display(GxEPD2_420c_Z21(/*CS=5*/ /* SS*/ D7, /*DC=*/D1, /*RST=*/D2, /*BUSY=*/D3)); // 400x300, UC8276
-U8G2_FOR_ADAFRUIT_GFX u8g2Fonts;                                                                                                       // u8g2 fonts
+EpdDisplay display(halPanel()); // panel and pins are chosen in hal.h
+U8G2_FOR_ADAFRUIT_GFX u8g2Fonts; // u8g2 fonts
 
 //=============== GLOBAL CONSTANTS ===============
-// Hardware pins
-#define BATPIN A0    // Battery voltage divider pin (1M Ohm with 104 Capacitor)
-#define DEBUG_PIN D6 // Debug mode toggle pin
-
 /**
  * @brief Battery level sampling parameters
  * BATTERY_LEVEL_SAMPLING: Number of samples to average for battery reading
@@ -253,10 +256,8 @@ U8G2_FOR_ADAFRUIT_GFX u8g2Fonts;
 
 /**
  * @brief Sleep configuration
- * uS_TO_S_FACTOR: Microseconds to seconds conversion
  * TIME_TO_SLEEP: Sleep duration in seconds (default 15 mins)
  */
-#define uS_TO_S_FACTOR 1000000
 int TIME_TO_SLEEP = 900;
 
 //=============== GLOBAL VARIABLES ===============
@@ -266,8 +267,6 @@ float battLevel;               // Current battery level
 bool DEBUG_MODE = false;       // Debug mode state
 bool BATTERY_CRITICAL = false; // Critical battery state
 
-String jsonBuffer; // for storing json data from api
-
 // for storing highest temp and lowest temp of the day
 float hTemp, lTemp;
 
@@ -278,8 +277,9 @@ int httpResponseCode; // for storing http response code
 
 // Define base URLs as const char arrays
 const char OPEN_WEATHER_BASE_URL[] = "http://api.openweathermap.org/data/3.0/onecall?lat=";
-const char OPEN_WEATHER_PARAMS[] = "&exclude=hourly,minutely&units=metric&appid=";
+const char OPEN_WEATHER_PARAMS[] = "&exclude=hourly,minutely,daily&units=metric&appid="; // sun and moon are computed by astro.h
 const char CUSTOM_WEATHER_BASE_URL[] = "http://iotthings.pythonanywhere.com/api/weatherStation/serve?api_key=";
+#define CUSTOM_FORMAT_BIN 0 // 1 asks the custom server for the 18 byte record of custom_record.h instead of JSON
 
 //=============== HELPER FUNCTIONS ===============
 
@@ -293,7 +293,7 @@ float batteryLevel()
   uint32_t Vbatt = 0;
   for (int i = 0; i < BATTERY_LEVEL_SAMPLING; i++)
   {
-    Vbatt = Vbatt + analogReadMilliVolts(BATPIN); // ADC with correction
+    Vbatt = Vbatt + halBatteryMilliVolts(); // ADC with correction
     delay(10);
   }
   float Vbattf = 2 * Vbatt / BATTERY_LEVEL_SAMPLING / 1000.0; // attenuation ratio 1/2, mV --> V
@@ -307,64 +307,79 @@ float batteryLevel()
  */
 void turnOffWifi()
 {
-  // Disable WiFi
-  WiFi.disconnect(true); // Disconnect and clear credentials
-  WiFi.mode(WIFI_OFF);   // Set WiFi mode to off
-  esp_wifi_stop();
-
-  // Additional power savings
-  btStop(); // Disable Bluetooth - more compatible than esp_bt_controller_disable()
+  // Disable WiFi and Bluetooth
+  halWifiOff();
 
   // Reduce CPU frequency last
-  if (getCpuFrequencyMhz() != 20)
-  {
-    setCpuFrequencyMhz(20); // Set CPU to 20MHz
-  }
+  halSetCpuMhz(20); // Set CPU to 20MHz
 
   delay(1);
   Serial.println("Power saving mode enabled");
-  Serial.println(getCpuFrequencyMhz());
+  Serial.println(halCpuMhz());
 }
 
-// forward declaration
-void tempPrint(byte offset = 0, bool invert = false);
-void weatherPrint(bool invert = false);
+// forward declaration, the render functions take any GxEPD2 display class and a table from layout.h
+template <const ScreenLayout &L, typename Display>
+void tempPrint(Display &display, const IndoorSnapshot &indoor);
+template <const ScreenLayout &L, typename Display>
+void weatherPrint(Display &display, const WeatherSnapshot &weather, const SkySnapshot &sky);
+template <const ScreenLayout &L, typename Display>
+void skyPrint(Display &display, const SkySnapshot &sky);
+template <typename Display>
+void networkInfo(Display &display, const WeatherSnapshot &weather);
+template <const ScreenLayout &L, typename Display>
+void wifiStatus(Display &display, const WeatherSnapshot &weather);
+template <const ScreenLayout &L, typename Display>
+void offlinePrint(Display &display, const IndoorSnapshot &indoor, const SkySnapshot &sky);
+template <const ScreenLayout &L>
+void ghostNote();
+
+// the Arduino IDE generates these, the host build (tools/host) compiles the sketch as plain C++
+void acquireIndoor(IndoorSnapshot &indoor);
+void acquireSky(SkySnapshot &sky);
+void acquireWeather(WeatherSnapshot &weather, bool fetchOwm, bool fetchCustom);
+uint32_t hashFrame(const IndoorSnapshot &indoor, const WeatherSnapshot &weather, const SkySnapshot &sky, bool showWeather);
+void hashWidgets(const IndoorSnapshot &indoor, const WeatherSnapshot &weather, const SkySnapshot &sky, uint32_t *hashes);
+void autoTimeUpdate();
+void streamImage(const PackedImage &black, const PackedImage *red, const LayoutRect &area);
+void errMsg(String msg);
+void debugPrinter(String msg);
 
 //=============== MAIN SETUP AND LOOP ===============
 void setup()
 {
+  perfStart();
   Serial.begin(115200);
   Serial.println("Setup");
-  if (getCpuFrequencyMhz() != 20)
-    setCpuFrequencyMhz(20); // Set CPU to 20MHz
-  Serial.println(getCpuFrequencyMhz());
-  pinMode(BATPIN, INPUT);
-  pinMode(DEBUG_PIN, INPUT);
-  pref.begin("database", false); // Open the preferences "database"
-  if (!pref.isKey("battCrit"))
-    pref.putBool("battCrit", false);
-  BATTERY_CRITICAL = pref.getBool("battCrit", false);
+  halSetCpuMhz(20); // Set CPU to 20MHz
+  Serial.println(halCpuMhz());
+  halAdcBegin();
+  halNvsBegin(); // Open the preferences "database"
+  if (!halNvsHas("battCrit"))
+    halNvsPutBool("battCrit", false);
+  BATTERY_CRITICAL = halNvsGetBool("battCrit", false);
   bool tempBATTERY_CRITICAL = BATTERY_CRITICAL;
 
   if (BATTERY_CRITICAL)
     turnOffWifi(); // wifioff cpu speed reduced to save power
 
-  if (digitalRead(DEBUG_PIN) == 1) // Check if debug mode is enabled
+  if (halDebugSwitch()) // Check if debug mode is enabled
     DEBUG_MODE = true;
-  Wire.begin();                         // Start the I2C communication
-  Wire.setClock(400000);                // Set clock speed to be the fastest for better communication (fast mode)
-  analogReadResolution(12);             // Set ADC resolution to 12-bit
+  halBusBegin();                        // Start the I2C communication
+  perfBegin(PERF_DISPLAY_INIT);
   display.init(115200, true, 2, false); // USE THIS for Waveshare boards with "clever" reset circuit, 2ms reset pulse
+  perfEnd(PERF_DISPLAY_INIT);
+  Serial.printf("Frame buffer: %u bytes, %u pages\n", 2 * (display.width() / 8) * display.pageHeight(), display.pages());
 
   u8g2Fonts.begin(display); // connect u8g2 procedures to Adafruit GFX
 
-  if (!pref.isKey("nightFlag"))
+  if (!halNvsHas("nightFlag"))
   { // create key:value pair
-    pref.putBool("nightFlag", false);
+    halNvsPutBool("nightFlag", false);
   }
-  nightFlag = pref.getBool("nightFlag", false);
+  nightFlag = halNvsGetBool("nightFlag", false);
 
-  if (lightMeter.begin(BH1750::ONE_TIME_HIGH_RES_MODE))
+  if (halLightBegin())
   {
     Serial.println(F("BH1750 Advanced begin"));
   }
@@ -375,12 +390,9 @@ void setup()
     while (1)
       ; // Runs forever
   }
-  float lux = 0; // Light level in lux
-  while (!lightMeter.measurementReady(true))
-  {
-    yield(); // Wait for the measurement to be ready
-  }
-  lux = lightMeter.readLightLevel(); // Get Lux value from sensor
+  perfBegin(PERF_LIGHT_WAIT);
+  float lux = halReadLux(); // Light level in lux
+  perfEnd(PERF_LIGHT_WAIT);
   Serial.print("Light: ");
   Serial.print(lux);
   Serial.println(" lx");
@@ -388,75 +400,39 @@ void setup()
   // if battery is critical, then no need to check wifi and weather api
   if ((!BATTERY_CRITICAL && lux != 0) || DEBUG_MODE == true)
   {
-    if (!pref.isKey("ssid"))
+    if (!halNvsHas("ssid"))
     { // create key:value pairs
-      pref.putString("ssid", "");
-      pref.putString("password", "");
+      halNvsPutString("ssid", "");
+      halNvsPutString("password", "");
     }
 
-    ssid = pref.getString("ssid", "");
-    password = pref.getString("password", "");
+    ssid = halNvsGetString("ssid", "");
+    password = halNvsGetString("password", "");
 
     if (ssid == "" || password == "")
     {
-      setCpuFrequencyMhz(80); // Set CPU to 80MHz for wifi manager
+      halSetCpuMhz(80); // Set CPU to 80MHz for wifi manager
       // if no ssid or password saved, then start the wifi manager
       Serial.println("No values saved for ssid or password");
       // Connect to Wi-Fi network with SSID and password
       Serial.println("Setting AP (Access Point)");
-      // NULL sets an open Access Point
-      WiFi.softAP("WCLOCK-WIFI-MANAGER", NULL);
-
-      IPAddress IP = WiFi.softAPIP();
+      String address = halWifiPortalBegin("WCLOCK-WIFI-MANAGER", index_html);
       Serial.print("AP IP address: ");
-      Serial.println(IP);
-
-      debugPrinter("Connect to 'WCLOCK-WIFI-MANAGER' \nfrom your phone or computer (Wifi).\n\nThen go to " + IP.toString() + "\nfrom your browser.");
-
-      // Web Server Root URL
-      server.on("/", HTTP_GET, [](AsyncWebServerRequest *request)
-                { request->send(200, "text/html", index_html); });
-
-      server.on("/", HTTP_POST, [](AsyncWebServerRequest *request)
-                {
-        int params = request->params();
-        for (int i = 0; i < params; i++) {
-          const AsyncWebParameter *p = request->getParam(i);
-          if (p->isPost()) {
-            // HTTP POST ssid value
-            if (p->name() == PARAM_INPUT_1) {
-              ssid = p->value();
-              Serial.print("SSID set to: ");
-              Serial.println(ssid);
-              ssid.trim();
-              pref.putString("ssid", ssid);
-            }
-            // HTTP POST pass value
-            if (p->name() == PARAM_INPUT_2) {
-              password = p->value();
-              Serial.print("Password set to: ");
-              Serial.println(password);
-              password.trim();
-              pref.putString("password", password);
-            }
-            //Serial.printf("POST[%s]: %s\n", p->name().c_str(), p->value().c_str());
-          }
-        }
-        request->send(200, "text/html", "<h2>Done. Weather Station will now restart</h2>");
-        delay(3000);
-        ESP.restart(); });
-      server.begin();
-      while (true)
-        ;
+      Serial.println(address);
+
+      debugPrinter("Connect to 'WCLOCK-WIFI-MANAGER' \nfrom your phone or computer (Wifi).\n\nThen go to " + address + "\nfrom your browser.");
+      halWifiPortalWait(); // restarts once the form is posted
     }
   }
 
   float hTempHold, lTempHold, tempBattLevel;
+  bool fetchOwm = false, fetchCustom = false; // endpoints whose cached data has expired
 
   // if lux is 0, then the device is in dark mode and no need to initialize sensors
   if (lux != 0 || DEBUG_MODE == true)
   {
-    if (!rtc.begin())
+    perfBegin(PERF_SENSOR_INIT);
+    if (!halRtcBegin())
     {
       Serial.println("Couldn't find RTC");
       errMsg("Error RTC");
@@ -465,15 +441,15 @@ void setup()
     }
     Serial.println("RTC Ready");
 
-    DateTime now = rtc.now();
+    DateTime now = halNow();
 
     if ((now.hour() == 0) && (now.minute() >= 0 && now.minute() < 15))
     { // reset high low at midnight
-      pref.putFloat("hTemp", 0.0);
-      pref.putFloat("lTemp", 60.0);
+      halNvsPutFloat("hTemp", 0.0);
+      halNvsPutFloat("lTemp", 60.0);
     }
 
-    if (sensor.begin() == true) // Function to check if the TMP117 will correctly self-identify with the proper Device ID/Address
+    if (halIndoorTempBegin()) // Function to check if the TMP117 will correctly self-identify with the proper Device ID/Address
     {
       Serial.println("TMP117 Begin");
     }
@@ -485,7 +461,7 @@ void setup()
         ; // Runs forever
     }
 
-    if (!bme.begin())
+    if (!halEnvBegin()) // also sets up oversampling and filter
     {
       Serial.println(F("Could not find a valid BME680 sensor, check wiring!"));
       errMsg("Error BME680");
@@ -494,65 +470,66 @@ void setup()
     }
 
     Serial.println("BME Ready");
+    perfEnd(PERF_SENSOR_INIT);
+
+    // Weather from an earlier wake is reused until its TTL runs out
+    fetchOwm = now.unixtime() - owmFetchedAt >= OWM_TTL;
+    fetchCustom = now.unixtime() - customFetchedAt >= CUSTOM_TTL;
 
-    // Set up oversampling and filter initialization
-    bme.setTemperatureOversampling(BME680_OS_2X);
-    bme.setHumidityOversampling(BME680_OS_16X);
-    bme.setPressureOversampling(BME680_OS_16X);
-    bme.setIIRFilterSize(BME680_FILTER_SIZE_7);
-    bme.setGasHeater(0, 0); // 0*C for 0 ms
+    // Check if we need to update time (once per day)
+    if (!halNvsHas("lastCheckedDay")) // create key:value pairs
+      halNvsPutUChar("lastCheckedDay", 0);
+    byte lastCheckedDay = halNvsGetUChar("lastCheckedDay", 0);
+    bool timeUpdateDue = lastCheckedDay != now.day();
 
-    if (!BATTERY_CRITICAL)
+    // WiFi is only started when there is something to fetch
+    if (!BATTERY_CRITICAL && (fetchOwm || fetchCustom || timeUpdateDue))
     {
       // Connect to Wi-Fi network with SSID and password if battery is not critical
-      setCpuFrequencyMhz(80); // Set CPU to 80MHz for wifi
+      halSetCpuMhz(80); // Set CPU to 80MHz for wifi
       delay(10);
-      WiFi.mode(WIFI_STA);
-      WiFi.begin(ssid.c_str(), password.c_str());
-      while (WiFi.waitForConnectResult() != WL_CONNECTED)
-      {
+      perfBegin(PERF_WIFI_CONNECT);
+      int64_t wifiStart = halMicros();
+      HalWifiResult wifiResult = halWifiConnect(ssid.c_str(), password.c_str());
+      perfEnd(PERF_WIFI_CONNECT);
+      if (wifiResult == HAL_WIFI_FAILED)
         Serial.println("Connection Failed");
-        break;
-      }
+      else
+        Serial.printf("WiFi connected in %lu ms (%s)\n", (unsigned long)((halMicros() - wifiStart) / 1000),
+                      wifiResult == HAL_WIFI_CACHED ? "cached AP" : "scan");
 
       Serial.println("IP Address: ");
-      Serial.println(WiFi.localIP());
+      Serial.println(halWifiLocalIp());
 
-      // Get the current day
-      DateTime now = rtc.now();
-      byte currentDay = now.day();
-
-      // Check if we need to update time (once per day)
-      if (!pref.isKey("lastCheckedDay")) // create key:value pairs
-        pref.putUChar("lastCheckedDay", 0);
-      byte lastCheckedDay = pref.getUChar("lastCheckedDay", 0);
-      if (lastCheckedDay != currentDay)
+      if (timeUpdateDue)
       {
         Serial.println("Updating time from NTP server");
+        perfBegin(PERF_TIME_UPDATE);
         autoTimeUpdate(); // Update time from NTP server
-        lastCheckedDay = currentDay;
-        pref.putUChar("lastCheckedDay", lastCheckedDay);
+        perfEnd(PERF_TIME_UPDATE);
+        lastCheckedDay = now.day();
+        halNvsPutUChar("lastCheckedDay", lastCheckedDay);
       }
 
       // Check if the API keys are saved in the preferences
-      if (!pref.isKey("api")) // create key:value pairs
-        pref.putString("api", openWeatherMapApiKey);
-      openWeatherMapApiKey = pref.getString("api", "");
+      if (!halNvsHas("api")) // create key:value pairs
+        halNvsPutString("api", openWeatherMapApiKey.c_str());
+      openWeatherMapApiKey = halNvsGetString("api", "");
 
-      if (!pref.isKey("apiCustom")) // create key:value pairs
-        pref.putString("apiCustom", customApiKey);
-      customApiKey = pref.getString("apiCustom", "");
+      if (!halNvsHas("apiCustom")) // create key:value pairs
+        halNvsPutString("apiCustom", customApiKey.c_str());
+      customApiKey = halNvsGetString("apiCustom", "");
     }
 
-    hTemp = pref.getFloat("hTemp", -1.0);
-    lTemp = pref.getFloat("lTemp", -1.0);
-    battLevel = pref.getFloat("battLevel", -1.0);
+    hTemp = halNvsGetFloat("hTemp", -1.0);
+    lTemp = halNvsGetFloat("lTemp", -1.0);
+    battLevel = halNvsGetFloat("battLevel", -1.0);
     if (hTemp == -1.0 || lTemp == -1.0 || battLevel == -1.0)
     {
       Serial.println("No values saved for hTemp, lTemp or battLevel");
-      pref.putFloat("hTemp", 0.0);
-      pref.putFloat("lTemp", 60.0);
-      pref.putFloat("battLevel", battType);
+      halNvsPutFloat("hTemp", 0.0);
+      halNvsPutFloat("lTemp", 60.0);
+      halNvsPutFloat("battLevel", battType);
     }
 
     hTempHold = hTemp, lTempHold = lTemp, tempBattLevel = battLevel;
@@ -565,6 +542,9 @@ void setup()
   if (DEBUG_MODE)
   {
     errMsg("DEBUG MODE"); // Display debug message
+    lastFrameHash = 0;
+    widgetsOnPanel = false;
+    Serial.print(perfReport());
   }
   else
   {
@@ -574,14 +554,11 @@ void setup()
       if (nightFlag == 0)
       { // prevents unnecessary redrawing of same thing
         nightFlag = 1;
-        display.setRotation(0);
-        display.setFullWindow();
-        display.firstPage();
-        do
-        {
-          display.fillScreen(GxEPD_WHITE);
-          display.drawInvertedBitmap(0, 0, nightMode, 400, 300, GxEPD_BLACK);
-        } while (display.nextPage());
+        lastFrameHash = 0;
+        widgetsOnPanel = false;
+        perfBegin(PERF_REFRESH);
+        streamImage(nightMode, nullptr, PanelLayouts::night);
+        perfEnd(PERF_REFRESH);
       }
       display.hibernate();
       display.powerOff();
@@ -589,73 +566,164 @@ void setup()
     else
     {
       nightFlag = 0;
-      display.setRotation(0);
-      display.setFullWindow();
-      display.firstPage();
-      do
+
+      // Acquisition: every sensor and network read happens once, before drawing
+      IndoorSnapshot indoor;
+      WeatherSnapshot weather;
+      SkySnapshot sky;
+      bool showWeather = halWifiConnected() && (fetchOwm || fetchCustom);
+      acquireIndoor(indoor);
+      acquireSky(sky);
+      if (showWeather)
+        acquireWeather(weather, fetchOwm, fetchCustom); // also turns WiFi off once the fetches are done
+      else
+      {
+        turnOffWifi(); // turn off wifi to save power when wifi is not connected
+        weather = cachedWeather;
+        // Nothing expired, draw the cached weather. A critical battery keeps WiFi off
+        // and always gets its own time-only screen
+        showWeather = !BATTERY_CRITICAL && !fetchOwm && !fetchCustom;
+        if (showWeather)
+          Serial.println("Weather from cache");
+      }
+
+      // An identical frame is not sent again, the panel keeps showing it unpowered
+      uint32_t frameHash = hashFrame(indoor, weather, sky, showWeather);
+      bool skipRefresh = frameHash == lastFrameHash && skippedFrames < maxSkippedFrames;
+
+      // Panels with fast partial update only redraw the regions that changed
+      uint32_t widgets[WIDGET_COUNT];
+      bool weatherLayout = showWeather && weather.valid;
+      if (weatherLayout)
+        hashWidgets(indoor, weather, sky, widgets);
+      // The inverted frame needs the weather layout for its note, otherwise the clean cycle waits
+      bool invert = !skipRefresh && showWeather && ghostCleanDue(ghostPolicy);
+      bool partial = !skipRefresh && !invert && weatherLayout && display.epd2.hasFastPartialUpdate &&
+                     widgetsOnPanel && partialRefreshes < fullRefreshEvery;
+      LayoutRect window;
+      if (partial && !dirtyWindow(PanelLayouts::widgets, widgets, widgetHashes, WIDGET_COUNT, window))
+      {
+        // Nothing drawn changed, the panel already shows this frame
+        partial = false;
+        skipRefresh = true;
+        lastFrameHash = frameHash;
+      }
+
+      if (skipRefresh)
+      {
+        skippedFrames++;
+        Serial.println("Frame unchanged, refresh skipped");
+      }
+      else if (partial)
+        Serial.println("Time And Weather, partial");
+      else if (showWeather)
+        Serial.println("Time And Weather");
+      else
+        Serial.println("Time Only");
+
+      if (partial)
       {
-        if (WiFi.status() == WL_CONNECTED)
+        // One window around every dirty region, the frame is rendered once and clipped to it
+        display.setRotation(0);
+        display.setPartialWindow(window.x, window.y, window.w, window.h);
+        display.firstPage();
+        do
         {
-          ++bootCount; // increment the boot counter
-          Serial.println("Time And Weather");
-          if (bootCount == ghostProtek)
+          perfEnd(PERF_REFRESH);
+          perfBegin(PERF_RENDER);
+          display.fillScreen(GxEPD_WHITE);
+          tempPrint<PanelLayouts::weather>(display, indoor);
+          weatherPrint<PanelLayouts::weather>(display, weather, sky);
+          perfEnd(PERF_RENDER);
+          perfBegin(PERF_REFRESH);
+        } while (display.nextPage());
+        perfEnd(PERF_REFRESH);
+        memcpy(widgetHashes, widgets, sizeof(widgetHashes));
+        lastFrameHash = frameHash;
+        skippedFrames = 0;
+        partialRefreshes++;
+      }
+      else if (!skipRefresh)
+      {
+        // Render: only reads the snapshots, safe to repeat for every page. A ghost
+        // protection frame is drawn normally and inverted as a whole before it is sent
+        display.setRotation(0);
+        display.setFullWindow();
+        display.setInverted(invert);
+        display.firstPage();
+        do
+        {
+          perfEnd(PERF_REFRESH);
+          perfBegin(PERF_RENDER);
+          if (showWeather)
           {
-            display.fillScreen(GxEPD_BLACK);
-            tempPrint(0, true); // prints temperature and battery level
-            weatherPrint(true); // prints weather data
+            display.fillScreen(GxEPD_WHITE);
+            tempPrint<PanelLayouts::weather>(display, indoor);          // prints temperature and battery level
+            weatherPrint<PanelLayouts::weather>(display, weather, sky); // prints weather data
+            if (invert)
+              ghostNote<PanelLayouts::weather>();
           }
           else
           {
             display.fillScreen(GxEPD_WHITE);
-            tempPrint();    // prints temperature and battery level
-            weatherPrint(); // prints weather data
+            if (indoor.battCritical)
+              offlinePrint<PanelLayouts::batteryCritical>(display, indoor, sky);
+            else
+              offlinePrint<PanelLayouts::wifiOff>(display, indoor, sky);
           }
-          if (bootCount == ghostProtek)
-            bootCount = 0;
-          Serial.println("Time And Weather Done");
-        }
-        else
-        {
-          display.fillScreen(GxEPD_WHITE);
-          turnOffWifi(); // turn off wifi to save power when wifi is not connected
-          Serial.println("Time Only");
-          display.drawBitmap(270, 0, wifiOff, 12, 12, GxEPD_BLACK); // wifi off icon
-          tempPrint(40);                                            // offset for wifi off which shifts the temperature display to the middle
-          Serial.println("Time Done");
-        }
-      } while (display.nextPage());
+          perfEnd(PERF_RENDER);
+          perfBegin(PERF_REFRESH);
+        } while (display.nextPage());
+        perfEnd(PERF_REFRESH);
+        display.setInverted(false);
+
+        // An inverted frame never matches, so the next wake draws it normal again
+        lastFrameHash = invert ? ~frameHash : frameHash;
+        skippedFrames = 0;
+
+        // Partial updates draw on a normal background, so they wait for the next normal frame
+        widgetsOnPanel = weatherLayout && !invert;
+        if (widgetsOnPanel)
+          memcpy(widgetHashes, widgets, sizeof(widgetHashes));
+        partialRefreshes = 0;
+      }
+      if (!skipRefresh)
+        ghostRecord(ghostPolicy, halNow().unixtime(), weatherLayout ? widgets : nullptr, partial, invert);
       display.hibernate();
       display.powerOff();
+      Serial.println(showWeather ? "Time And Weather Done" : "Time Done");
     }
 
     Serial.println("Data Write");
+    perfBegin(PERF_NVS_WRITE);
 
     if (lux != 0)
     { // if lux is 0, then the device is in sleep mode and no need to save data
       if (hTempHold != hTemp)
-        pref.putFloat("hTemp", hTemp);
+        halNvsPutFloat("hTemp", hTemp);
       if (lTempHold != lTemp)
-        pref.putFloat("lTemp", lTemp);
+        halNvsPutFloat("lTemp", lTemp);
       if (tempBattLevel != battLevel)
-        pref.putFloat("battLevel", battLevel);
+        halNvsPutFloat("battLevel", battLevel);
       if (tempBATTERY_CRITICAL != BATTERY_CRITICAL)
-        pref.putBool("battCrit", BATTERY_CRITICAL);
+        halNvsPutBool("battCrit", BATTERY_CRITICAL);
     }
     if (tempNightFlag != nightFlag) // if night mode changes, then save the new state
-      pref.putBool("nightFlag", nightFlag);
+      halNvsPutBool("nightFlag", nightFlag);
 
+    halNvsEnd(); // Close the preferences
+    perfEnd(PERF_NVS_WRITE);
     Serial.println("Data Write Done");
-    pref.end(); // Close the preferences
     Serial.println("Setup ESP32 to sleep for every " + String(TIME_TO_SLEEP / 60) + " Mins");
 
-    Wire.end();                                                    // End I2C communication
-    esp_sleep_enable_timer_wakeup(TIME_TO_SLEEP * uS_TO_S_FACTOR); // Set the sleep time
+    halBusEnd(); // End I2C communication
     //  Go to sleep now
     Serial.println("Going to sleep now");
     Serial.flush(); // Flush the serial buffer
     delay(5);       // Delay to ensure all the serial data is sent
+    perfCommit();   // keep this wake's timing in RTC memory
     // Enter deep sleep
-    esp_deep_sleep_start();
+    halDeepSleep(TIME_TO_SLEEP);
   }
 }
 
@@ -666,582 +734,758 @@ void loop()
 //=============== WEATHER AND DISPLAY FUNCTIONS ===============
 
 /**
- * @brief Fetches weather data from API endpoint
- * @param serverName URL of the weather API endpoint
- * @return String JSON response from server
+ * @brief Feeds a chunk of the response body to the JSON extractor
+ * @param ctx The JsonStreamExtractor of the running request
+ * @return bool false to stop reading once the body is not valid JSON
  */
-String weatherDataAPI(const char *serverName)
+bool jsonSink(const uint8_t *data, size_t len, void *ctx)
 {
-  WiFiClient client;
-  HTTPClient http;
+  perfBegin(PERF_JSON_PARSE);
+  bool ok = static_cast<JsonStreamExtractor *>(ctx)->feed(data, len);
+  perfEnd(PERF_JSON_PARSE);
+  return ok;
+}
 
-  // Your Domain name with URL path or IP address with path
-  http.begin(client, serverName);
+/**
+ * @brief Copies the fields that come from One Call
+ * @note Used to clear them before a fetch and to restore them after a 304
+ */
+void copyOwmFields(WeatherSnapshot &to, const WeatherSnapshot &from)
+{
+  to.valid = from.valid;
+  to.feelsLike = from.feelsLike;
+  to.uvi = from.uvi;
+  memcpy(to.icon, from.icon, sizeof(to.icon));
+  memcpy(to.main, from.main, sizeof(to.main));
+  memcpy(to.alert, from.alert, sizeof(to.alert));
+}
 
-  // Send HTTP POST request
-  httpResponseCode = http.GET();
+/**
+ * @brief Collects the binary record of the custom server
+ */
+struct RecordBuffer
+{
+  uint8_t data[CUSTOM_RECORD_SIZE];
+  size_t len; // bytes received, may exceed the record, decoding fails then
+};
 
-  String payload = "{}";
+/**
+ * @brief Appends a chunk of the response body to a RecordBuffer
+ * @return bool false once the body is longer than a record
+ */
+bool recordSink(const uint8_t *data, size_t len, void *ctx)
+{
+  RecordBuffer &record = *static_cast<RecordBuffer *>(ctx);
+  if (record.len + len > sizeof(record.data))
+  {
+    record.len += len;
+    return false;
+  }
+  memcpy(record.data + record.len, data, len);
+  record.len += len;
+  return true;
+}
+
+/**
+ * @brief Reports the outcome of one weather API request
+ * @param name Endpoint name for the log
+ * @param request Request finished by halHttpGetAll()
+ * @param complete Whether the body was decoded in full
+ * @return bool false when a response arrived but could not be decoded
+ */
+bool weatherDataAPI(const char *name, const HttpRequest &request, bool complete)
+{
+  httpResponseCode = request.code;
 
   if (httpResponseCode > 0)
-  {
     Serial.print("HTTP Response code: ");
-    Serial.println(httpResponseCode);
-    payload = http.getString();
-  }
   else
-  {
     Serial.print("Error code: ");
-    Serial.println(httpResponseCode);
-  }
-  // Free resources
-  http.end();
+  Serial.printf("%d (%s, %lu ms, %lu bytes)\n", httpResponseCode, name, (unsigned long)(request.latencyUs / 1000),
+                (unsigned long)request.bodyBytes);
 
-  return payload;
+  // 304 Not Modified has no body, the cached fields are kept
+  return httpResponseCode <= 0 || httpResponseCode == 304 || complete;
 }
 
 /**
- * @brief Prints temperature and environmental data
- * @param offset Vertical offset for display positioning (default: 0)
- * @param invert Inverts colors for ghost protection (default: false)
+ * @brief Reads indoor sensors, battery and clock into a snapshot
+ * @param indoor Filled with this wake's readings
+ * @note Also updates hTemp, lTemp, battLevel and BATTERY_CRITICAL for the NVS write
  */
-void tempPrint(byte offset, bool invert)
+void acquireIndoor(IndoorSnapshot &indoor)
 {
-  // Configure fonts and colors once at the start
-  uint16_t bg = invert ? GxEPD_BLACK : GxEPD_WHITE;
-  uint16_t fg = invert ? GxEPD_WHITE : GxEPD_BLACK;
-  uint16_t lineColor = (BATTERY_CRITICAL || invert) ? GxEPD_WHITE : GxEPD_RED;
-
-  u8g2Fonts.setFontMode(1);
-  u8g2Fonts.setFontDirection(0);
-  u8g2Fonts.setForegroundColor(fg);
-  u8g2Fonts.setBackgroundColor(bg);
-
   // Temperature reading
   float tempC = 0;
-  if (sensor.dataReady())
+  if (halReadIndoorTemp(tempC))
   {
-    tempC = sensor.readTempC();
     hTemp = max(hTemp, tempC);
     lTemp = min(lTemp, tempC);
   }
+  indoor.tempC = tempC;
+  indoor.hTemp = hTemp;
+  indoor.lTemp = lTemp;
 
   // Battery level handling
   float newBattLevel = batteryLevel();
   battLevel = (newBattLevel < battLevel) ? newBattLevel : ((newBattLevel - battLevel) >= battChangeThreshold || newBattLevel > battUpperLim) ? newBattLevel
                                                                                                                                              : battLevel;
+  indoor.battLevel = battLevel;
+  indoor.percent = constrain(((battLevel - battLow) / (battHigh - battLow)) * 100, 0, 100);
+  BATTERY_CRITICAL = indoor.percent < 3;
+  indoor.battCritical = BATTERY_CRITICAL;
+
+  // Time and date
+  DateTime now = halNow();
+  indoor.hour = now.hour();
+  indoor.minute = now.minute();
+  indoor.day = now.day();
+  indoor.month = now.month();
+  indoor.wday = now.dayOfTheWeek();
 
-  // Battery display section
-  u8g2Fonts.setFont(u8g2_font_luRS08_tf);
-  u8g2Fonts.setCursor(28, 11);
-  u8g2Fonts.print(battLevel, 2);
-  u8g2Fonts.print("V");
+  // Environmental readings
+  indoor.envValid = halReadEnv(indoor.humidity, indoor.pressure);
+  if (!indoor.envValid)
+    Serial.println("BME READING ERROR");
+}
+
+/**
+ * @brief Computes today's sunrise and sunset and the current moon phase
+ * @param sky Filled from lat/lon and the RTC, works without WiFi
+ */
+void acquireSky(SkySnapshot &sky)
+{
+  DateTime now = halNow(); // local time
+  astroSunTimes(now.year(), now.month(), now.day(), lat.toFloat(), lon.toFloat(), sky.sunrise, sky.sunset);
+  sky.moonPhase = astroMoonPhase(now.unixtime() - UTC_OFFSET);
+}
+
+/**
+ * @brief Picks the fields we draw out of the One Call response
+ * @param ctx The WeatherSnapshot being filled
+ */
+void owmValue(const char *path, const char *value, void *ctx)
+{
+  WeatherSnapshot &weather = *static_cast<WeatherSnapshot *>(ctx);
+
+  if (strcmp(path, "current.temp") == 0)
+    weather.valid = strcmp(value, "null") != 0;
+  else if (strcmp(path, "current.feels_like") == 0)
+    weather.feelsLike = atof(value);
+  else if (strcmp(path, "current.uvi") == 0)
+    weather.uvi = atof(value);
+  else if (strcmp(path, "current.weather[0].icon") == 0)
+    strlcpy(weather.icon, value, sizeof(weather.icon));
+  else if (strcmp(path, "current.weather[0].main") == 0)
+    strlcpy(weather.main, value, sizeof(weather.main));
+  else if (strcmp(path, "alerts[0].event") == 0)
+    strlcpy(weather.alert, value, sizeof(weather.alert));
+}
+
+/**
+ * @brief Picks the outdoor sensor readings out of the custom server response
+ * @param ctx The WeatherSnapshot being filled
+ */
+void customValue(const char *path, const char *value, void *ctx)
+{
+  WeatherSnapshot &weather = *static_cast<WeatherSnapshot *>(ctx);
+
+  if (strcmp(path, "data.temp") == 0)
+    weather.outdoorTemp = atof(value);
+  else if (strcmp(path, "data.humidity") == 0)
+    weather.outdoorHum = atof(value);
+  else if (strcmp(path, "data.pressure") == 0)
+    weather.outdoorPres = atof(value);
+}
+
+/**
+ * @brief Fetches the stale weather endpoints and parses them into a snapshot
+ * @param weather Filled with outdoor conditions and network diagnostics
+ * @param fetchOwm Request One Call, otherwise its cached fields are kept
+ * @param fetchCustom Request the custom server, otherwise its cached fields are kept
+ * @note Requires active WiFi connection and valid API keys, turns WiFi off when done
+ */
+void acquireWeather(WeatherSnapshot &weather, bool fetchOwm, bool fetchCustom)
+{
+  weather = cachedWeather;
+  if (fetchOwm) // start the One Call fields over, an alert that has ended must not linger
+    copyOwmFields(weather, WeatherSnapshot());
 
-  int percent = constrain(((battLevel - battLow) / (battHigh - battLow)) * 100, 0, 100);
-  BATTERY_CRITICAL = percent < 3;
+  char serverPath[256]; // Buffer for API URL
+  strcpy(serverPath, OPEN_WEATHER_BASE_URL);
+  strcat(serverPath, lat.c_str());
+  strcat(serverPath, "&lon=");
+  strcat(serverPath, lon.c_str());
+  strcat(serverPath, OPEN_WEATHER_PARAMS);
+  strcat(serverPath, openWeatherMapApiKey.c_str());
+
+  char customPath[128]; // Buffer for custom weather URL
+  strcpy(customPath, CUSTOM_WEATHER_BASE_URL);
+  strcat(customPath, customApiKey.c_str());
+  if (CUSTOM_FORMAT_BIN)
+    strcat(customPath, "&format=bin");
 
-  u8g2Fonts.setCursor(63, 11);
-  if (!BATTERY_CRITICAL)
+  // The stale endpoints are requested at once, each body is parsed while it
+  // is received and only the fields we draw are kept
+  struct Endpoint
   {
-    u8g2Fonts.print(percent, 1);
-    u8g2Fonts.print("%");
-    if (invert)
+    const char *name;
+    PerfPhase phase;
+    uint32_t *fetchedAt;
+    HttpValidators *validators; // committed only once the response is parsed
+  };
+  Endpoint endpoints[2];
+  JsonStreamExtractor parsers[2];
+  RecordBuffer record = {};
+  HttpValidators validators[2];
+  HttpRequest requests[2] = {};
+  size_t count = 0;
+  if (fetchOwm)
+  {
+    endpoints[count] = {"OpenWeatherMap", PERF_FETCH_OWM, &owmFetchedAt, &owmValidators};
+    parsers[count].begin(owmValue, &weather);
+    requests[count].url = serverPath;
+    requests[count].sink = jsonSink;
+    requests[count].ctx = &parsers[count];
+    requests[count].compressed = true; // One Call is the big one, worth the 32 KB inflate window
+    count++;
+  }
+  if (fetchCustom)
+  {
+    endpoints[count] = {"custom", PERF_FETCH_CUSTOM, &customFetchedAt, &customValidators};
+    parsers[count].begin(customValue, &weather);
+    requests[count].url = customPath;
+    if (CUSTOM_FORMAT_BIN)
+    {
+      requests[count].sink = recordSink;
+      requests[count].ctx = &record;
+    }
+    else
+    {
+      requests[count].sink = jsonSink;
+      requests[count].ctx = &parsers[count];
+    }
+    count++;
+  }
+  for (size_t i = 0; i < count; i++)
+  {
+    validators[i] = *endpoints[i].validators;
+    requests[i].validators = &validators[i];
+  }
+  halHttpGetAll(requests, count);
+
+  bool parsed = true, restart = false;
+  for (size_t i = 0; i < count; i++)
+  {
+    perfAdd(endpoints[i].phase, requests[i].latencyUs);
+    perfAdd(PERF_DNS, requests[i].dnsUs);
+    perfAdd(PERF_DNS_SAVED, requests[i].dnsSavedUs);
+    bool complete = requests[i].ctx == &record ? customRecordDecode(record.data, record.len, weather) : parsers[i].done();
+    parsed &= weatherDataAPI(endpoints[i].name, requests[i], complete);
+    restart |= httpResponseCode == -1 || httpResponseCode == -11;
+  }
+  if (restart)
+    halRestart();
+  if (!parsed)
+  {
+    Serial.println("Parsing input failed!");
+    halRestart();
+    return;
+  }
+
+  // Network diagnostics, the radio is off by the time we draw
+  weather.httpCode = httpResponseCode;
+  weather.rssi = halWifiRssi();
+  halWifiSsid(weather.ssid, sizeof(weather.ssid));
+
+  // Turn off WiFi as soon as possible after data fetch
+  turnOffWifi();
+
+  // Remember what arrived, failed endpoints are requested again next wake
+  uint32_t now = halNow().unixtime();
+  for (size_t i = 0; i < count; i++)
+  {
+    const bool owm = endpoints[i].fetchedAt == &owmFetchedAt;
+    if (requests[i].code == 304 && owm)
+      copyOwmFields(weather, cachedWeather); // not modified, keep what was parsed before
+    if (requests[i].code == 200 || requests[i].code == 304)
     {
-      u8g2Fonts.setCursor(123, 11);
-      u8g2Fonts.print(" GHOSTING PROTECTION");
+      *endpoints[i].fetchedAt = now;
+      *endpoints[i].validators = validators[i];
+    }
+    else if (requests[i].code <= 0)
+    {
+      // Cut short or not decodable, drop whatever part of the body was parsed
+      if (owm)
+        copyOwmFields(weather, WeatherSnapshot());
+      else
+      {
+        weather.outdoorTemp = cachedWeather.outdoorTemp;
+        weather.outdoorHum = cachedWeather.outdoorHum;
+        weather.outdoorPres = cachedWeather.outdoorPres;
+      }
     }
   }
+  cachedWeather = weather;
+}
+
+/**
+ * @brief Formats a reading the way the JSON payload spells it
+ * @note Up to 2 decimals, trailing zeros dropped (28.50 -> 28.5, 1012.00 -> 1012)
+ */
+void formatReading(char *out, size_t len, float value)
+{
+  snprintf(out, len, "%.2f", value);
+  char *end = out + strlen(out) - 1;
+  while (*end == '0')
+    *end-- = '\0';
+  if (*end == '.')
+    *end = '\0';
+}
+
+/**
+ * @brief Prints temperature and environmental data
+ * @param display Panel to draw on
+ * @param indoor Readings taken by acquireIndoor()
+ * @note Positions and fonts come from the layout L
+ */
+template <const ScreenLayout &L, typename Display>
+void tempPrint(Display &display, const IndoorSnapshot &indoor)
+{
+  constexpr const IndoorLayout &lay = L.indoor;
+
+  // Configure fonts and colors once at the start
+  const Palette pal = panelPalette<Display>();
+  uint16_t bg = pal.bg;
+  uint16_t fg = pal.fg;
+  uint16_t lineColor = indoor.battCritical ? pal.bg : pal.accent;
+
+  u8g2Fonts.setFontMode(1);
+  u8g2Fonts.setFontDirection(0);
+  u8g2Fonts.setForegroundColor(fg);
+  u8g2Fonts.setBackgroundColor(bg);
+
+  // Battery display section
+  u8g2Fonts.setFont(lay.battery.font);
+  u8g2Fonts.setCursor(lay.battery.x, lay.battery.y);
+  u8g2Fonts.print(indoor.battLevel, 2);
+  u8g2Fonts.print("V");
+
+  u8g2Fonts.setCursor(lay.percent.x, lay.percent.y);
+  if (!indoor.battCritical)
+  {
+    u8g2Fonts.print(indoor.percent, 1);
+    u8g2Fonts.print("%");
+  }
   else
   {
     u8g2Fonts.print("BATTERY CRITICAL, WIFI TURNED OFF");
   }
-  iconBattery(display, percent, invert);
+  iconBattery(display, indoor.percent);
 
   // Time and date display
-  DateTime now = rtc.now();
   char timeStr[6];
-  sprintf(timeStr, "%02d:%02d", now.hour(), now.minute());
+  sprintf(timeStr, "%02d:%02d", indoor.hour, indoor.minute);
 
-  u8g2Fonts.setCursor(295, 11);
+  u8g2Fonts.setCursor(lay.lastUpdate.x, lay.lastUpdate.y);
   u8g2Fonts.print("Last Update: ");
   u8g2Fonts.print(timeStr);
 
-  u8g2Fonts.setFont(u8g2_font_logisoso20_tf);
-  u8g2Fonts.setCursor(10, 75 + offset);
-  u8g2Fonts.print(now.day() < 10 ? "0" : "");
-  u8g2Fonts.print(now.day());
+  u8g2Fonts.setFont(lay.date.font);
+  u8g2Fonts.setCursor(lay.date.x, lay.date.y);
+  u8g2Fonts.print(indoor.day < 10 ? "0" : "");
+  u8g2Fonts.print(indoor.day);
   u8g2Fonts.print(", ");
-  u8g2Fonts.print(monthName[now.month() - 1]);
-  u8g2Fonts.setCursor(10, 105 + offset);
-  u8g2Fonts.print(daysOfTheWeek[now.dayOfTheWeek()]);
+  u8g2Fonts.print(monthName[indoor.month - 1]);
+  u8g2Fonts.setCursor(lay.weekday.x, lay.weekday.y);
+  u8g2Fonts.print(daysOfTheWeek[indoor.wday]);
 
   // Main temperature display
-  u8g2Fonts.setFont(u8g2_font_inb19_mf);
-  u8g2Fonts.setCursor(320, 60 + offset);
+  u8g2Fonts.setFont(lay.tempDegree.font);
+  u8g2Fonts.setCursor(lay.tempDegree.x, lay.tempDegree.y);
   u8g2Fonts.print("o");
 
-  u8g2Fonts.setFont(u8g2_font_logisoso58_tf);
-  u8g2Fonts.setCursor(150, 110 + offset);
-  u8g2Fonts.print(String(tempC));
-  u8g2Fonts.setCursor(330, 110 + offset);
+  u8g2Fonts.setFont(lay.temp.font);
+  u8g2Fonts.setCursor(lay.temp.x, lay.temp.y);
+  u8g2Fonts.print(String(indoor.tempC));
+  u8g2Fonts.setCursor(lay.tempUnit.x, lay.tempUnit.y);
   u8g2Fonts.print("C");
 
   // Draw separator lines
-  for (int i = 0; i < 2; i++)
+  for (const LayoutRect &line : lay.separators)
   {
-    display.fillRect(0, 121 + offset + (i * 33), 400, 2, lineColor);
+    display.fillRect(line.x, line.y, line.w, line.h, lineColor);
   }
 
-  // Environmental readings
-  if (!bme.beginReading() || !bme.endReading())
-  {
-    Serial.println("BME READING ERROR");
+  if (!indoor.envValid)
     return;
-  }
 
   // Display environmental data
-  u8g2Fonts.setFont(u8g2_font_logisoso20_tf);
-  u8g2Fonts.setCursor(2, 150 + offset);
-  u8g2Fonts.print(bme.humidity);
+  u8g2Fonts.setFont(lay.humidity.font);
+  u8g2Fonts.setCursor(lay.humidity.x, lay.humidity.y);
+  u8g2Fonts.print(indoor.humidity);
   u8g2Fonts.print("%");
 
-  u8g2Fonts.setCursor(264, 150 + offset);
-  u8g2Fonts.print(bme.pressure / 100.0);
+  u8g2Fonts.setCursor(lay.pressure.x, lay.pressure.y);
+  u8g2Fonts.print(indoor.pressure);
   u8g2Fonts.print("hPa");
 
   // High/Low temperature display
-  u8g2Fonts.setFont(u8g2_font_logisoso16_tf);
   const char *labels[] = {"H:", "L:"};
-  float temps[] = {hTemp, lTemp};
-  int positions[] = {85, 180};
+  float temps[] = {indoor.hTemp, indoor.lTemp};
 
   for (int i = 0; i < 2; i++)
   {
-    u8g2Fonts.setCursor(positions[i], 148 + offset);
+    const LayoutText &pos = lay.highLow[i];
+    u8g2Fonts.setFont(pos.font);
+    u8g2Fonts.setCursor(pos.x, pos.y);
     u8g2Fonts.print(labels[i]);
     u8g2Fonts.print(temps[i]);
-    u8g2Fonts.setFont(u8g2_font_fub11_tf);
-    u8g2Fonts.setCursor(positions[i] + 63, 138 + offset);
+    u8g2Fonts.setFont(lay.highLowDegree.font);
+    u8g2Fonts.setCursor(pos.x + lay.highLowDegree.x, lay.highLowDegree.y);
     u8g2Fonts.print("o");
-    u8g2Fonts.setFont(u8g2_font_logisoso16_tf);
-    u8g2Fonts.setCursor(positions[i] + 73, 148 + offset);
+    u8g2Fonts.setFont(pos.font);
+    u8g2Fonts.setCursor(pos.x + lay.highLowUnit, pos.y);
     u8g2Fonts.print("C");
   }
 }
 
 /**
- * @brief Fetches and displays weather data
- * @param invert Inverts display colors for ghost protection
- * @note Requires active WiFi connection and valid API keys
+ * @brief Marks a ghost protection frame next to the battery percentage
+ * @note Drawn in the normal colours like the rest of the frame, which is inverted as a whole
  */
-void weatherPrint(bool invert)
+template <const ScreenLayout &L>
+void ghostNote()
 {
-  uint16_t bg = invert ? GxEPD_BLACK : GxEPD_WHITE;
-  uint16_t fg = invert ? GxEPD_WHITE : GxEPD_BLACK;
-  uint16_t red = invert ? GxEPD_WHITE : GxEPD_RED;
-
-  char serverPath[256]; // Buffer for API URL
-  strcpy(serverPath, OPEN_WEATHER_BASE_URL);
-  strcat(serverPath, lat.c_str());
-  strcat(serverPath, "&lon=");
-  strcat(serverPath, lon.c_str());
-  strcat(serverPath, OPEN_WEATHER_PARAMS);
-  strcat(serverPath, openWeatherMapApiKey.c_str());
+  u8g2Fonts.setFont(L.indoor.battery.font);
+  u8g2Fonts.setForegroundColor(GxEPD_BLACK);
+  u8g2Fonts.setCursor(L.indoor.ghost.x, L.indoor.ghost.y);
+  u8g2Fonts.print(" GHOSTING PROTECTION");
+}
 
-  jsonBuffer = weatherDataAPI(serverPath);
-  if (httpResponseCode == -1 || httpResponseCode == -11)
-    ESP.restart();
-  Serial.println(jsonBuffer);
-  JSONVar myObject = JSON.parse(jsonBuffer);
+/**
+ * @brief Hashes a reading as it is printed, 2 decimals
+ * @note Noise below the printed precision leaves the hash alone
+ */
+uint32_t hashReading(uint32_t h, float value)
+{
+  char text[16];
+  snprintf(text, sizeof(text), "%.2f", value);
+  return hashStr(h, text);
+}
 
-  // JSON.typeof(jsonVar) can be used to get the type of the var
-  if (JSON.typeof(myObject) == "undefined")
+/**
+ * @brief Fingerprint of everything the day screen is drawn from
+ * @param showWeather Weather layout, otherwise the WiFi-off layout
+ * @return uint32_t Equal for frames that render the same pixels
+ * @note Hashes field by field, struct padding is never read. The time is left
+ *       out: "Last Update" is the time of the last refresh, so a skipped frame
+ *       still shows the right one
+ */
+uint32_t hashFrame(const IndoorSnapshot &indoor, const WeatherSnapshot &weather, const SkySnapshot &sky, bool showWeather)
+{
+  uint32_t h = hashValue(HASH_INIT, showWeather);
+
+  h = hashValue(h, indoor.day);
+  h = hashValue(h, indoor.month);
+  h = hashValue(h, indoor.wday);
+  h = hashReading(h, indoor.tempC);
+  h = hashReading(h, indoor.hTemp);
+  h = hashReading(h, indoor.lTemp);
+  h = hashReading(h, indoor.battLevel);
+  h = hashValue(h, indoor.percent);
+  h = hashValue(h, indoor.battCritical);
+  h = hashValue(h, indoor.envValid);
+  h = hashReading(h, indoor.humidity);
+  h = hashReading(h, indoor.pressure);
+
+  h = hashValue(h, sky.sunrise);
+  h = hashValue(h, sky.sunset);
+  h = hashValue(h, (uint8_t)(sky.moonPhase * 256)); // the float moves every wake, the icon only every few hours
+
+  if (!showWeather)
+    return h;
+
+  h = hashValue(h, weather.valid);
+  h = hashValue(h, weather.rssi >= -60); // wifiStatus() only shows two levels
+  if (!weather.valid)
   {
-    Serial.println("Parsing input failed!");
-    ESP.restart();
-    return;
+    // networkInfo() prints the connection details instead of the weather
+    h = hashValue(h, weather.httpCode);
+    h = hashValue(h, weather.rssi);
+    h = hashStr(h, weather.ssid);
   }
+  h = hashReading(h, weather.outdoorTemp);
+  h = hashReading(h, weather.outdoorHum);
+  h = hashReading(h, weather.outdoorPres);
+  h = hashReading(h, weather.feelsLike);
+  h = hashReading(h, weather.uvi);
+  h = hashStr(h, weather.icon);
+  h = hashStr(h, weather.main);
+  h = hashStr(h, weather.alert);
+  return h;
+}
 
-  // Override with custom weather URL
-  strcpy(serverPath, CUSTOM_WEATHER_BASE_URL);
-  strcat(serverPath, customApiKey.c_str());
-  jsonBuffer = weatherDataAPI(serverPath);
-  if (httpResponseCode == -1 || httpResponseCode == -11)
-    ESP.restart();
-  Serial.println(jsonBuffer);
-  JSONVar customObject = JSON.parse(jsonBuffer);
-
-  // JSON.typeof(jsonVar) can be used to get the type of the var
-  if (JSON.typeof(customObject) == "undefined")
-  {
-    Serial.println("Parsing input failed!");
-    ESP.restart();
-    return;
-  }
+/**
+ * @brief Fingerprint of each region of the weather layout
+ * @param hashes Filled with one hash per Widget, see PanelLayouts::widgets
+ * @note Every value drawn inside a box has to go into its hash, a missed one
+ *       leaves stale pixels until the next full refresh
+ */
+void hashWidgets(const IndoorSnapshot &indoor, const WeatherSnapshot &weather, const SkySnapshot &sky, uint32_t *hashes)
+{
+  uint32_t h = hashReading(HASH_INIT, indoor.battLevel);
+  h = hashValue(h, indoor.percent);
+  h = hashValue(h, indoor.battCritical);
+  h = hashValue(h, indoor.hour);
+  h = hashValue(h, indoor.minute);
+  hashes[WIDGET_STATUS] = hashValue(h, weather.rssi >= -60); // wifiStatus() only shows two levels
 
-  if (myObject["current"]["temp"] == null)
-  {
-    networkInfo();
-    // Turn off WiFi as soon as possible after data fetch
-    turnOffWifi();
-  }
-  else
-  {
-    wifiStatus(invert);
-    // Turn off WiFi as soon as possible after data fetch
-    turnOffWifi();
-    u8g2Fonts.setFontMode(1);
-    u8g2Fonts.setFontDirection(0);
-    u8g2Fonts.setForegroundColor(fg);
-    u8g2Fonts.setBackgroundColor(bg);
-
-    u8g2Fonts.setFont(u8g2_font_helvB10_tf);
-    u8g2Fonts.setCursor(29, 170);
-    u8g2Fonts.print("OUTDOOR");
-    u8g2Fonts.setFont(u8g2_font_fub20_tf); // u8g2_font_fub30_tf
-    uint16_t width;
-    width = u8g2Fonts.getUTF8Width(JSON.stringify(customObject["data"]["temp"]).c_str());
-    u8g2Fonts.setCursor(20, 200); // start writing at this position
-    u8g2Fonts.print(customObject["data"]["temp"]);
-    u8g2Fonts.setCursor(30 + width, 200);
-    u8g2Fonts.print("C");
-    u8g2Fonts.setFont(u8g2_font_fub11_tf);
-    u8g2Fonts.setCursor(22 + width, 185); // start writing at this position
-    u8g2Fonts.print("o");
+  hashes[WIDGET_ALERT] = hashStr(HASH_INIT, weather.alert);
 
-    u8g2Fonts.setFont(u8g2_font_fur11_tf); // u8g2_font_fur14_tf
-    width = u8g2Fonts.getUTF8Width(("Real Feel:" + JSON.stringify(myObject["current"]["feels_like"])).c_str());
-    u8g2Fonts.setCursor(5, 220); // start writing at this position
-    u8g2Fonts.print("Real Feel:");
-    u8g2Fonts.setCursor(75, 220);
-    u8g2Fonts.print(myObject["current"]["feels_like"]);
-    u8g2Fonts.setCursor(width + 16, 220);
-    u8g2Fonts.print(String("C"));
-    u8g2Fonts.setFont(u8g2_font_baby_tf); // u8g2_font_robot_de_niro_tf
-    u8g2Fonts.setCursor(13 + width, 211); // start writing at this position
-    u8g2Fonts.print("o");
+  h = hashValue(HASH_INIT, indoor.day);
+  h = hashValue(h, indoor.month);
+  hashes[WIDGET_DATE] = hashValue(h, indoor.wday);
 
-    u8g2Fonts.setFont(u8g2_font_fur14_tf);
-    u8g2Fonts.setCursor(5, 245); // start writing at this position
-    u8g2Fonts.print(customObject["data"]["humidity"]);
-    u8g2Fonts.print(String("%"));
-
-    u8g2Fonts.setCursor(5, 270); // start writing at this position
-    u8g2Fonts.print(customObject["data"]["pressure"]);
-    u8g2Fonts.print(String("hPa"));
-    u8g2Fonts.setFont(u8g2_font_helvB10_tf);
-    u8g2Fonts.setCursor(5, 294); // start writing at this position
-    u8g2Fonts.print("UVI: ");
-    u8g2Fonts.print(myObject["current"]["uvi"]);
-    u8g2Fonts.setFont(u8g2_font_fur11_tf);
-    double uv = double(myObject["current"]["uvi"]);
-    if (uv < 2)
-      u8g2Fonts.print(" Low");
-    else if (uv < 5)
-      u8g2Fonts.print(" Medium");
-    else if (uv <= 7)
-      u8g2Fonts.print(" High");
-    else if (uv > 7)
-      u8g2Fonts.print(" Danger");
-
-    // Draw vertical divider line
-    display.fillRect(136, 155, 2, 144, red); // 144 = 299-155
-
-    // Sunset sunrise print
-    char timeBuffer[6];
-    for (int i = 0; i < 2; i++)
-    {
-      time_t t = strtoll(JSON.stringify(myObject["current"][i == 0 ? "sunrise" : "sunset"]).c_str(), nullptr, 10);
-      if (t > 0)
-      {
-        setTime(t);
-        adjustTime(19800); // UTC+5:30 offset
+  hashes[WIDGET_INDOOR] = hashReading(HASH_INIT, indoor.tempC);
 
-        // Format time as HH:MM
-        snprintf(timeBuffer, sizeof(timeBuffer), "%02d:%02d", hour(), minute());
+  h = hashValue(HASH_INIT, indoor.battCritical); // colour of the separator lines
+  h = hashValue(h, indoor.envValid);
+  h = hashReading(h, indoor.humidity);
+  h = hashReading(h, indoor.pressure);
+  h = hashReading(h, indoor.hTemp);
+  hashes[WIDGET_ENV] = hashReading(h, indoor.lTemp);
 
-        // Draw icon and time
-        iconSunRise(display, i == 0 ? 152 : 267, 170, i == 0, invert);
-        u8g2Fonts.setCursor(i == 0 ? 166 : 281, 175);
-        u8g2Fonts.print(timeBuffer);
-      }
-    }
+  h = hashReading(HASH_INIT, weather.outdoorTemp);
+  h = hashReading(h, weather.outdoorHum);
+  h = hashReading(h, weather.outdoorPres);
+  h = hashReading(h, weather.feelsLike);
+  hashes[WIDGET_OUTDOOR] = hashReading(h, weather.uvi);
 
-    // Vertical divider line
-    display.fillRect(320, 155, 2, 144, red); // 144 = 299-155
-    // Horizontal divider line
-    display.fillRect(320, 230, 80, 2, red); // 80 = 400-320
+  h = hashValue(HASH_INIT, sky.sunrise);
+  hashes[WIDGET_SUN] = hashValue(h, sky.sunset);
 
-    iconMoonPhase(display, 360, 260, 20, double(myObject["daily"][0]["moon_phase"]), invert);
-    u8g2Fonts.setFont(u8g2_font_luRS08_tf);
-    u8g2Fonts.setCursor(330, 297);
-    u8g2Fonts.print("Moon Phase");
+  h = hashStr(HASH_INIT, weather.icon);
+  hashes[WIDGET_ICON] = hashStr(h, weather.main);
 
-    String s = JSON.stringify(myObject["current"]["weather"][0]["icon"]);
-    int lastIndex = s.length() - 1;
-    s.remove(lastIndex);
-    s.remove(0, 1);
+  hashes[WIDGET_MOON] = hashValue(HASH_INIT, (uint8_t)(sky.moonPhase * 256));
+}
 
-    if (s == "01d")
-    { // Clear Day
-      iconSun(display, 361, 189, 15, invert);
-    }
-    else if (s == "01n") // Clear Night
-      iconMoon(display, 361, 189, 15, invert);
-    else if (s == "02d") // few clouds
-      iconCloudyDay(display, 330, 160, 60, invert);
-    else if (s == "02n")
-      iconCloudyNight(display, 330, 160, 60, invert);
-    else if (s == "03d") // scattered clouds
-      iconCloud(display, 361, 189, 15, invert);
-    else if (s == "03n")
-      iconCloud(display, 361, 189, 15, invert);
-    else if (s == "04d") // broken clouds (two clouds)
-      iconCloudy(display, 330, 160, 60, invert);
-    else if (s == "04n")
-      iconCloudy(display, 330, 160, 60, invert);
-    else if (s == "09d") // shower rain
-      iconSleet(display, 330, 160, 60, invert);
-    else if (s == "09n")
-      iconSleet(display, 330, 160, 60, invert);
-    else if (s == "10d") // snow
-      iconRain(display, 330, 160, 60, invert);
-    else if (s == "10n")
-      iconRain(display, 330, 160, 60, invert);
-    else if (s == "11d") // thunderstorm
-      iconThunderstorm(display, 330, 160, 60, invert);
-    else if (s == "11n")
-      iconThunderstorm(display, 330, 160, 60, invert);
-    else if (s == "13d") // snow
-      iconSnow(display, 330, 160, 60, invert);
-    else if (s == "13n")
-      iconSnow(display, 330, 160, 60, invert);
-    else if (s == "50d") // mist
-      iconFog(display, 330, 160, 60, invert);
-    else if (s == "50n")
-      iconFog(display, 330, 160, 60, invert);
-
-    u8g2Fonts.setFont(u8g2_font_luRS08_tf); // u8g2_font_fur11_tf
-    s = JSON.stringify(myObject["current"]["weather"][0]["main"]);
-    lastIndex = s.length() - 1;
-    s.remove(lastIndex);
-    s.remove(0, 1);
-    u8g2Fonts.setCursor(330, 227);
-    u8g2Fonts.print(s);
+/**
+ * @brief Prints sunrise, sunset and the moon phase widget
+ * @param display Panel to draw on
+ * @param sky Values computed by acquireSky()
+ * @note Positions and fonts come from the layout L
+ */
+template <const ScreenLayout &L, typename Display>
+void skyPrint(Display &display, const SkySnapshot &sky)
+{
+  constexpr const SkyLayout &lay = L.sky;
 
-    // u8g2Fonts.setCursor(186, 200);
-    s = JSON.stringify(myObject["alerts"][0]["event"]);
-    lastIndex = s.length() - 1;
-    s.remove(lastIndex);
-    s.remove(0, 1);
-    if (s != "ul")
+  // Sunset sunrise print
+  char timeBuffer[6];
+  for (int i = 0; i < 2; i++)
+  {
+    time_t t = i == 0 ? sky.sunrise : sky.sunset;
+    if (t > 0)
     {
-      int16_t tbx, tby;
-      uint16_t tbw, tbh;
-      display.getTextBounds("Alerts: " + s, 0, 0, &tbx, &tby, &tbw, &tbh);
-      // center the bounding box by transposition of the origin:
-      uint16_t x = ((display.width() - tbw) / 2) - tbx;
-      u8g2Fonts.setCursor(x, 25); // start writing at this position
-      u8g2Fonts.print("Alerts: ");
-      u8g2Fonts.print(s);
+      DateTime local((uint32_t)(t + UTC_OFFSET));
+
+      // Format time as HH:MM
+      snprintf(timeBuffer, sizeof(timeBuffer), "%02d:%02d", local.hour(), local.minute());
+
+      // Draw icon and time
+      iconSunRise(display, lay.sunIconX[i], lay.sun[i].y + lay.sunIconDy, i == 0);
+      u8g2Fonts.setFont(lay.sun[i].font);
+      u8g2Fonts.setCursor(lay.sun[i].x, lay.sun[i].y);
+      u8g2Fonts.print(timeBuffer);
     }
   }
+
+  iconMoonPhase(display, lay.moon.x, lay.moon.y, lay.moonR, sky.moonPhase);
+  u8g2Fonts.setFont(lay.moonLabel.font);
+  u8g2Fonts.setCursor(lay.moonLabel.x, lay.moonLabel.y);
+  u8g2Fonts.print("Moon Phase");
 }
 
-// UNCOMMENT BELOW FUNCTION AND REMOVE THE ABOVE FUNCTION WITH THE SAME NAME IF YOU WISH TO USE ONLY oPENwEATHERmAP API
-/*
-void weatherPrint()
+/**
+ * @brief Picks the sprite for an OpenWeatherMap icon code
+ * @param icon Code such as "01d", the day/night letter only matters for clear sky and few clouds
+ * @return int IconSpriteId, -1 for unknown codes
+ */
+int iconSpriteFor(const char *icon)
 {
-  String serverPath = "http://api.openweathermap.org/data/3.0/onecall?lat=" + lat + "&lon=" + lon + "&exclude=hourly,minutely&units=metric&appid=" + openWeatherMapApiKey;
+  static const struct
+  {
+    char code[4];
+    IconSpriteId sprite;
+  } codes[] = {
+      {"01d", ICON_SPRITE_SUN},           // clear sky
+      {"01n", ICON_SPRITE_MOON},
+      {"02d", ICON_SPRITE_CLOUDY_DAY},    // few clouds
+      {"02n", ICON_SPRITE_CLOUDY_NIGHT},
+      {"03", ICON_SPRITE_CLOUD},          // scattered clouds
+      {"04", ICON_SPRITE_CLOUDY},         // broken clouds (two clouds)
+      {"09", ICON_SPRITE_SLEET},          // shower rain
+      {"10", ICON_SPRITE_RAIN},           // rain
+      {"11", ICON_SPRITE_THUNDERSTORM},   // thunderstorm
+      {"13", ICON_SPRITE_SNOW},           // snow
+      {"50", ICON_SPRITE_FOG},            // mist
+  };
+  for (const auto &entry : codes)
+  {
+    if (strncmp(icon, entry.code, strlen(entry.code)) == 0 && (strlen(entry.code) == 3 || icon[2] == 'd' || icon[2] == 'n'))
+      return entry.sprite;
+  }
+  return -1;
+}
 
-  jsonBuffer = weatherDataAPI(serverPath.c_str());
-  if (httpResponseCode == -1 || httpResponseCode == -11)
-    ESP.restart();
-  Serial.println(jsonBuffer);
-  JSONVar myObject = JSON.parse(jsonBuffer);
+/**
+ * @brief Draws the screen without weather, used while WiFi is off
+ * @param display Panel to draw on
+ * @param indoor Readings taken by acquireIndoor()
+ * @param sky Sun and moon computed by acquireSky(), they need no network
+ */
+template <const ScreenLayout &L, typename Display>
+void offlinePrint(Display &display, const IndoorSnapshot &indoor, const SkySnapshot &sky)
+{
+  display.drawBitmap(L.wifiIcon.x, L.wifiIcon.y, wifiOff, 12, 12, GxEPD_BLACK); // wifi off icon
+  tempPrint<L>(display, indoor);
+  skyPrint<L>(display, sky);
+}
+
+/**
+ * @brief Displays weather data
+ * @param display Panel to draw on
+ * @param weather Outdoor conditions fetched by acquireWeather()
+ * @param sky Sun and moon computed by acquireSky()
+ * @note Positions and fonts come from the layout L
+ */
+template <const ScreenLayout &L, typename Display>
+void weatherPrint(Display &display, const WeatherSnapshot &weather, const SkySnapshot &sky)
+{
+  constexpr const WeatherLayout &lay = L.weather;
+  const Palette pal = panelPalette<Display>();
+  uint16_t bg = pal.bg;
+  uint16_t fg = pal.fg;
+  uint16_t red = pal.accent;
 
-  // JSON.typeof(jsonVar) can be used to get the type of the var
-  if (JSON.typeof(myObject) == "undefined")
+  if (!weather.valid)
   {
-    Serial.println("Parsing input failed!");
-    ESP.restart();
+    networkInfo(display, weather);
     return;
   }
 
-  if (myObject["current"]["temp"] == null)
+  wifiStatus<L>(display, weather);
+  u8g2Fonts.setFontMode(1);
+  u8g2Fonts.setFontDirection(0);
+  u8g2Fonts.setForegroundColor(fg);
+  u8g2Fonts.setBackgroundColor(bg);
+
+  char value[16];
+  u8g2Fonts.setFont(lay.title.font);
+  u8g2Fonts.setCursor(lay.title.x, lay.title.y);
+  u8g2Fonts.print("OUTDOOR");
+  u8g2Fonts.setFont(lay.temp.font);
+  uint16_t width;
+  formatReading(value, sizeof(value), weather.outdoorTemp);
+  width = u8g2Fonts.getUTF8Width(value);
+  u8g2Fonts.setCursor(lay.temp.x, lay.temp.y); // start writing at this position
+  u8g2Fonts.print(value);
+  u8g2Fonts.setCursor(lay.tempUnit + width, lay.temp.y);
+  u8g2Fonts.print("C");
+  u8g2Fonts.setFont(lay.tempDegree.font);
+  u8g2Fonts.setCursor(lay.tempDegree.x + width, lay.tempDegree.y); // start writing at this position
+  u8g2Fonts.print("o");
+
+  u8g2Fonts.setFont(lay.feelsLike.font);
+  formatReading(value, sizeof(value), weather.feelsLike);
+  width = u8g2Fonts.getUTF8Width(("Real Feel:" + String(value)).c_str());
+  u8g2Fonts.setCursor(lay.feelsLike.x, lay.feelsLike.y); // start writing at this position
+  u8g2Fonts.print("Real Feel:");
+  u8g2Fonts.setCursor(lay.feelsValueX, lay.feelsLike.y);
+  u8g2Fonts.print(value);
+  u8g2Fonts.setCursor(width + lay.feelsUnit, lay.feelsLike.y);
+  u8g2Fonts.print(String("C"));
+  u8g2Fonts.setFont(lay.feelsDegree.font);
+  u8g2Fonts.setCursor(lay.feelsDegree.x + width, lay.feelsDegree.y); // start writing at this position
+  u8g2Fonts.print("o");
+
+  u8g2Fonts.setFont(lay.humidity.font);
+  u8g2Fonts.setCursor(lay.humidity.x, lay.humidity.y); // start writing at this position
+  formatReading(value, sizeof(value), weather.outdoorHum);
+  u8g2Fonts.print(value);
+  u8g2Fonts.print(String("%"));
+
+  u8g2Fonts.setCursor(lay.pressure.x, lay.pressure.y); // start writing at this position
+  formatReading(value, sizeof(value), weather.outdoorPres);
+  u8g2Fonts.print(value);
+  u8g2Fonts.print(String("hPa"));
+  u8g2Fonts.setFont(lay.uvi.font);
+  u8g2Fonts.setCursor(lay.uvi.x, lay.uvi.y); // start writing at this position
+  u8g2Fonts.print("UVI: ");
+  formatReading(value, sizeof(value), weather.uvi);
+  u8g2Fonts.print(value);
+  u8g2Fonts.setFont(lay.uviLevelFont);
+  float uv = weather.uvi;
+  if (uv < 2)
+    u8g2Fonts.print(" Low");
+  else if (uv < 5)
+    u8g2Fonts.print(" Medium");
+  else if (uv <= 7)
+    u8g2Fonts.print(" High");
+  else if (uv > 7)
+    u8g2Fonts.print(" Danger");
+
+  // Divider lines
+  for (const LayoutRect &line : lay.dividers)
+    display.fillRect(line.x, line.y, line.w, line.h, red);
+
+  skyPrint<L>(display, sky);
+
+  // Icons are blitted from sprites made by tools/icon_sprites.cpp at these sizes. The sun
+  // was no faster as a sprite (icon_sprites --bench), it has none
+  static_assert(lay.iconSmallR == ICON_SPRITE_SMALL_R && lay.iconLargeS == ICON_SPRITE_LARGE_S,
+                "icon sizes changed, regenerate icon_sprites.h");
+  int sprite = iconSpriteFor(weather.icon);
+  if (sprite == ICON_SPRITE_SUN)
+    iconSun(display, lay.iconSmall.x, lay.iconSmall.y, lay.iconSmallR);
+  else if (sprite >= 0)
   {
-    networkInfo();
+    const IconSprite &icon = iconSprites[sprite];
+    const LayoutPoint &at = icon.large ? lay.iconLarge : lay.iconSmall;
+    drawIconSprite(display, at.x, at.y, icon);
   }
-  else
-  {
-    wifiStatus();
-    u8g2Fonts.setFont(u8g2_font_helvB10_tf);
-    u8g2Fonts.setCursor(29, 170);
-    u8g2Fonts.print("OUTDOOR");
-    u8g2Fonts.setFont(u8g2_font_fub20_tf); // u8g2_font_fub30_tf
-    uint16_t width;
-    width = u8g2Fonts.getUTF8Width(JSON.stringify(myObject["current"]["temp"]).c_str());
-    u8g2Fonts.setCursor(20, 200); // start writing at this position
-    u8g2Fonts.print(myObject["current"]["temp"]);
-    u8g2Fonts.setCursor(30 + width, 200);
-    u8g2Fonts.print("C");
-    u8g2Fonts.setFont(u8g2_font_fub11_tf);
-    u8g2Fonts.setCursor(22 + width, 185); // start writing at this position
-    u8g2Fonts.print("o");
 
-    u8g2Fonts.setFont(u8g2_font_fur11_tf); // u8g2_font_fur14_tf
-    width = u8g2Fonts.getUTF8Width(("Real Feel:" + JSON.stringify(myObject["current"]["feels_like"])).c_str());
-    u8g2Fonts.setCursor(5, 220); // start writing at this position
-    u8g2Fonts.print("Real Feel:");
-    u8g2Fonts.setCursor(75, 220);
-    u8g2Fonts.print(myObject["current"]["feels_like"]);
-    u8g2Fonts.setCursor(width + 16, 220);
-    u8g2Fonts.print(String("C"));
-    u8g2Fonts.setFont(u8g2_font_baby_tf); // u8g2_font_robot_de_niro_tf
-    u8g2Fonts.setCursor(13 + width, 211); // start writing at this position
-    u8g2Fonts.print("o");
+  u8g2Fonts.setFont(lay.main.font);
+  u8g2Fonts.setCursor(lay.main.x, lay.main.y);
+  u8g2Fonts.print(weather.main);
 
-    u8g2Fonts.setFont(u8g2_font_fur14_tf);
-    u8g2Fonts.setCursor(5, 245); // start writing at this position
-    u8g2Fonts.print(myObject["current"]["humidity"]);
-    u8g2Fonts.print(String("%"));
-
-    u8g2Fonts.setCursor(5, 270); // start writing at this position
-    u8g2Fonts.print(myObject["current"]["pressure"]);
-    u8g2Fonts.print(String("hPa"));
-    u8g2Fonts.setFont(u8g2_font_helvB10_tf);
-    u8g2Fonts.setCursor(5, 294); // start writing at this position
-    u8g2Fonts.print("UVI: ");
-    u8g2Fonts.print(myObject["current"]["uvi"]);
-    u8g2Fonts.setFont(u8g2_font_fur11_tf);
-    double uv = double(myObject["current"]["uvi"]);
-    if (uv < 2)
-      u8g2Fonts.print(" Low");
-    else if (uv < 5)
-      u8g2Fonts.print(" Medium");
-    else if (uv <= 7)
-      u8g2Fonts.print(" High");
-    else if (uv > 7)
-      u8g2Fonts.print(" Danger");
-    display.drawLine(136, 155, 136, 299, GxEPD_RED);
-    display.drawLine(137, 155, 137, 299, GxEPD_RED);
-
-    // Sunset sunrise print
-    time_t t = strtoll(JSON.stringify(myObject["current"]["sunrise"]).c_str(), nullptr, 10);
-    setTime(t);
-    adjustTime(19800);
-    iconSunRise(display, 152, 170, true);
-    u8g2Fonts.setCursor(166, 175); // start writing at this position
-    u8g2Fonts.print("0");
-    u8g2Fonts.print(hour());
-    u8g2Fonts.print(":");
-    u8g2Fonts.print(minute() < 10 ? "0" + String(minute()) : minute());
-
-    t = strtoll(JSON.stringify(myObject["current"]["sunset"]).c_str(), nullptr, 10);
-    setTime(t);
-    adjustTime(19800);
-    iconSunRise(display, 267, 170, false);
-    u8g2Fonts.setCursor(281, 175);
-    u8g2Fonts.print(hour());
-    u8g2Fonts.print(":");
-    u8g2Fonts.print(minute() < 10 ? "0" + String(minute()) : minute());
-
-    display.drawLine(320, 155, 320, 299, GxEPD_RED);
-    display.drawLine(321, 155, 321, 299, GxEPD_RED);
-    display.drawLine(320, 230, 400, 230, GxEPD_RED);
-    display.drawLine(320, 231, 400, 231, GxEPD_RED);
-
-    iconMoonPhase(display, 360, 260, 20, double(myObject["daily"][0]["moon_phase"]));
-    u8g2Fonts.setFont(u8g2_font_luRS08_tf);
-    u8g2Fonts.setCursor(330, 297);
-    u8g2Fonts.print("Moon Phase");
-
-    String s = JSON.stringify(myObject["current"]["weather"][0]["icon"]);
-    int lastIndex = s.length() - 1;
-    s.remove(lastIndex);
-    s.remove(0, 1);
-
-    if (s == "01d")
-    { // Clear Day
-      iconSun(display, 361, 189, 15);
-      // iconSleet(x,y,r);//iconHail(x,y,r);//same
-      // iconWind(x,y,r);
-      // iconTornado(x,y,r);
-    }
-    else if (s == "01n") // Clear Night
-      iconMoon(display, 361, 189, 15);
-    else if (s == "02d") // few clouds
-      iconCloudyDay(display, 330, 160, 60);
-    else if (s == "02n")
-      iconCloudyNight(display, 330, 160, 60);
-    else if (s == "03d") // scattered clouds
-      iconCloud(display, 361, 189, 15);
-    else if (s == "03n")
-      iconCloud(display, 361, 189, 15);
-    else if (s == "04d") // broken clouds (two clouds)
-      iconCloudy(display, 330, 160, 60);
-    else if (s == "04n")
-      iconCloudy(display, 330, 160, 60);
-    else if (s == "09d") // shower rain
-      iconSleet(display, 330, 160, 60);
-    else if (s == "09n")
-      iconSleet(display, 330, 160, 60);
-    else if (s == "10d") // snow
-      iconRain(display, 330, 160, 60);
-    else if (s == "10n")
-      iconRain(display, 330, 160, 60);
-    else if (s == "11d") // thunderstorm
-      iconThunderstorm(display, 330, 160, 60);
-    else if (s == "11n")
-      iconThunderstorm(display, 330, 160, 60);
-    else if (s == "13d") // snow
-      iconSnow(display, 330, 160, 60);
-    else if (s == "13n")
-      iconSnow(display, 330, 160, 60);
-    else if (s == "50d") // mist
-      iconFog(display, 330, 160, 60);
-    else if (s == "50n")
-      iconFog(display, 330, 160, 60);
-
-    u8g2Fonts.setFont(u8g2_font_luRS08_tf); // u8g2_font_fur11_tf
-    s = JSON.stringify(myObject["current"]["weather"][0]["main"]);
-    lastIndex = s.length() - 1;
-    s.remove(lastIndex);
-    s.remove(0, 1);
-    u8g2Fonts.setCursor(330, 227);
+  // u8g2Fonts.setCursor(186, 200);
+  if (weather.alert[0] != '\0')
+  {
+    String s = weather.alert;
+    int16_t tbx, tby;
+    uint16_t tbw, tbh;
+    display.getTextBounds("Alerts: " + s, 0, 0, &tbx, &tby, &tbw, &tbh);
+    // center the bounding box by transposition of the origin:
+    uint16_t x = ((display.width() - tbw) / 2) - tbx;
+    u8g2Fonts.setCursor(x, lay.alertY); // start writing at this position
+    u8g2Fonts.print("Alerts: ");
     u8g2Fonts.print(s);
-
-    // u8g2Fonts.setCursor(186, 200);
-    s = JSON.stringify(myObject["alerts"][0]["event"]);
-    lastIndex = s.length() - 1;
-    s.remove(lastIndex);
-    s.remove(0, 1);
-    if (s != "ul")
-    {
-      int16_t tbx, tby;
-      uint16_t tbw, tbh;
-      display.getTextBounds("Alerts: " + s, 0, 0, &tbx, &tby, &tbw, &tbh);
-      // center the bounding box by transposition of the origin:
-      uint16_t x = ((display.width() - tbw) / 2) - tbx;
-      u8g2Fonts.setCursor(x, 25); // start writing at this position
-      u8g2Fonts.print("Alerts: ");
-      u8g2Fonts.print(s);
-    }
   }
-  // Turn off WiFi as soon as possible after data fetch
-  turnOffWifi();
-}*/
+}
 
 /**
  * @brief Updates RTC time if 20 days have passed since last update
  */
 void autoTimeUpdate()
 {
-  if (!pref.isKey("lastUpdateDay"))
-    pref.putUChar("lastUpdateDay", 0);
+  if (!halNvsHas("lastUpdateDay"))
+    halNvsPutUChar("lastUpdateDay", 0);
 
-  byte lastUpdateDay = pref.getUChar("lastUpdateDay", 0);
-  DateTime now = rtc.now();
+  byte lastUpdateDay = halNvsGetUChar("lastUpdateDay", 0);
+  DateTime now = halNow();
   byte currentDay = now.day();
 
   // Calculate days passed, handling month rollover
@@ -1250,28 +1494,15 @@ void autoTimeUpdate()
   // Check if 20 days have passed since last update
   if (lastUpdateDay == 0 || daysPassed >= 20)
   {
-    if (WiFi.status() == WL_CONNECTED)
+    DateTime ntp;
+    if (halNtpTime(NTP_SERVER, UTC_OFFSET, ntp))
     {
-      timeClient.begin();
-      if (timeClient.update() && timeClient.isTimeSet())
-      {
-        time_t rawtime = timeClient.getEpochTime();
-        struct tm *ti = localtime(&rawtime);
-
-        uint16_t year = ti->tm_year + 1900;
-        uint8_t month = ti->tm_mon + 1;
-        uint8_t day = ti->tm_mday;
-
-        rtc.adjust(DateTime(year, month, day,
-                            timeClient.getHours(),
-                            timeClient.getMinutes(),
-                            timeClient.getSeconds()));
-
-        // Update last update day
-        pref.putUChar("lastUpdateDay", currentDay);
-        Serial.println("RTC updated: " + String(year) + "-" +
-                       String(month) + "-" + String(day));
-      }
+      halRtcAdjust(ntp);
+
+      // Update last update day
+      halNvsPutUChar("lastUpdateDay", currentDay);
+      Serial.println("RTC updated: " + String(ntp.year()) + "-" +
+                     String(ntp.month()) + "-" + String(ntp.day()));
     }
   }
 }
@@ -1280,9 +1511,12 @@ void autoTimeUpdate()
 
 /**
  * @brief Displays network debugging information
+ * @param display Panel to draw on
+ * @param weather Diagnostics captured during the fetch
  * @note Shows WiFi status, signal strength, and HTTP response codes
  */
-void networkInfo()
+template <typename Display>
+void networkInfo(Display &display, const WeatherSnapshot &weather)
 {
   display.drawBitmap(270, 0, wifiError, 13, 13, GxEPD_BLACK);
   display.drawBitmap(100, 160, net, 29, 28, GxEPD_BLACK);
@@ -1293,20 +1527,18 @@ void networkInfo()
   u8g2Fonts.setFont(u8g2_font_logisoso16_tf);
   u8g2Fonts.setCursor(5, 220); // start writing at this position
   u8g2Fonts.print("Connected: ");
-  if (WiFi.status() == WL_CONNECTED)
-    u8g2Fonts.print("Yes (" + String(WiFi.SSID()) + ")");
-  else
-    u8g2Fonts.print("No");
+  // weather is only fetched while connected
+  u8g2Fonts.print("Yes (" + String(weather.ssid) + ")");
   u8g2Fonts.setCursor(5, 245); // start writing at this position
-  u8g2Fonts.print("HTTP Code: " + String(httpResponseCode));
+  u8g2Fonts.print("HTTP Code: " + String(weather.httpCode));
   u8g2Fonts.setCursor(5, 270); // start writing at this position
-  u8g2Fonts.print("WiFi RSSI: " + String(WiFi.RSSI()));
+  u8g2Fonts.print("WiFi RSSI: " + String(weather.rssi));
 
-  if (WiFi.RSSI() > -50)
+  if (weather.rssi > -50)
     u8g2Fonts.print(" Excellent");
-  else if (WiFi.RSSI() > -60)
+  else if (weather.rssi > -60)
     u8g2Fonts.print(" Good");
-  else if (WiFi.RSSI() > -70)
+  else if (weather.rssi > -70)
     u8g2Fonts.print(" Fair");
   else
     u8g2Fonts.print(" Poor");
@@ -1314,14 +1546,46 @@ void networkInfo()
 
 /**
  * @brief Displays WiFi signal strength indicator
- * @param invert Inverts icon colors for ghost protection
+ * @param display Panel to draw on
+ * @param weather Diagnostics captured during the fetch
  */
-void wifiStatus(bool invert)
+template <const ScreenLayout &L, typename Display>
+void wifiStatus(Display &display, const WeatherSnapshot &weather)
 {
-  if (WiFi.RSSI() >= -60)
-    display.drawBitmap(270, 0, wifiOn, 12, 12, invert ? GxEPD_WHITE : GxEPD_BLACK);
+  const Palette pal = panelPalette<Display>();
+  if (weather.rssi >= -60)
+    display.drawBitmap(L.wifiIcon.x, L.wifiIcon.y, wifiOn, 12, 12, pal.fg);
   else
-    display.drawBitmap(270, 0, wifiAvg, 12, 12, invert ? GxEPD_WHITE : GxEPD_BLACK);
+    display.drawBitmap(L.wifiIcon.x, L.wifiIcon.y, wifiAvg, 12, 12, pal.fg);
+}
+
+/**
+ * @brief Unpacks a static full screen image from flash straight into the panel RAM and refreshes
+ * @param black Black plane
+ * @param red Red plane of the same size, nullptr leaves it empty
+ * @param area Where the image goes, the rest of the panel is cleared to white
+ * @note Nothing goes through the frame buffer or the GFX pixel path, the
+ *       image is unpacked a band of rows at a time and sent as it is.
+ *       Images that also need text (errMsg) still have to be drawn page by page.
+ */
+void streamImage(const PackedImage &black, const PackedImage *red, const LayoutRect &area)
+{
+  const uint16_t rowBytes = (black.w + 7) / 8;
+  const uint16_t bandRows = 1024 / rowBytes;
+  uint8_t blackBand[1024], redBand[1024];
+  PackBitsReader blackRows(black), redRows(red ? *red : black);
+
+  if (area.w != display.epd2.WIDTH || area.h != display.epd2.HEIGHT)
+    display.epd2.writeScreenBuffer();
+  for (uint16_t y = 0; y < black.h; y += bandRows)
+  {
+    const uint16_t rows = min<uint16_t>(bandRows, black.h - y);
+    blackRows.read(blackBand, rows * rowBytes);
+    if (red)
+      redRows.read(redBand, rows * rowBytes);
+    display.epd2.writeImage(blackBand, red ? redBand : nullptr, area.x, area.y + y, black.w, rows, false, false, false);
+  }
+  display.epd2.refresh(false);
 }
 
 /**
@@ -1338,12 +1602,14 @@ void errMsg(String msg)
   // center the bounding box by transposition of the origin:
   uint16_t x = ((display.width() - tbw) / 2) - tbx;
   uint16_t y = ((display.height() - tbh) / 2) - tby;
+  uint8_t icon[(alert.w + 7) / 8 * alert.h];
+  PackBitsReader(alert).read(icon, sizeof(icon));
   display.setFullWindow();
   display.firstPage();
   do
   {
     display.fillScreen(GxEPD_WHITE);
-    display.drawInvertedBitmap(151, 40, alert, 100, 90, GxEPD_BLACK);
+    display.drawBitmap(151, 40, icon, alert.w, alert.h, GxEPD_WHITE, GxEPD_BLACK);
     display.setCursor(x, y);
     display.print(msg);
   } while (display.nextPage());
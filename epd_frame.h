@@ -0,0 +1,308 @@
+#ifndef EPD_FRAME_H
+#define EPD_FRAME_H
+
+// Paged e-paper display class in place of GxEPD2_3C/GxEPD2_BW, with the same
+// calls the sketch uses (init, full and partial windows, firstPage/nextPage,
+// the epd2 driver member). The page buffer is a FramePlanes, so lines,
+// rectangles, spans and bitmaps are written a byte at a time instead of one
+// drawPixel() per pixel. The fast paths cover rotation 0, other rotations go
+// through the Adafruit_GFX defaults and drawPixel().
+
+#include <Adafruit_GFX.h>
+#include <GxEPD2.h>
+#include <algorithm>
+#include <type_traits>
+#include "frame_planes.h"
+
+template <typename Panel, uint16_t PageHeight>
+class EpdFrame : public Adafruit_GFX
+{
+public:
+    Panel epd2;
+
+    explicit EpdFrame(Panel panel) : Adafruit_GFX(Panel::WIDTH, Panel::HEIGHT), epd2(panel)
+    {
+        setFullWindow();
+    }
+
+    void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration, bool pulldown_rst_mode)
+    {
+        epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+        setFullWindow();
+    }
+
+    uint16_t pageHeight() const { return PageHeight; }
+    uint16_t pages() const { return (Panel::HEIGHT + PageHeight - 1) / PageHeight; }
+
+    void setFullWindow()
+    {
+        partialMode = false;
+        setWindow(0, 0, Panel::WIDTH, Panel::HEIGHT);
+    }
+
+    /**
+     * @brief Limits drawing and the next refresh to a part of the panel
+     * @note In panel coordinates (rotation 0), x and w are widened to whole bytes
+     */
+    void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+        x = std::min<uint16_t>(x, +Panel::WIDTH);
+        y = std::min<uint16_t>(y, +Panel::HEIGHT);
+        w = std::min<uint16_t>(w, Panel::WIDTH - x) + x % 8;
+        h = std::min<uint16_t>(h, Panel::HEIGHT - y);
+        partialMode = true;
+        setWindow(x - x % 8, y, (w + 7) & ~7, h);
+    }
+
+    void firstPage()
+    {
+        page = 0;
+        secondPhase = false;
+        fillScreen(GxEPD_WHITE);
+    }
+
+    /**
+     * @brief Sends the page just drawn, refreshes after the last one
+     * @return bool true while there are pages left to draw
+     * @note Panels with fast partial update keep the previous frame in a second
+     *       controller buffer, it gets the same image again after the refresh.
+     *       With one page that is the buffer still in RAM, otherwise the pages
+     *       are drawn a second time.
+     */
+    bool nextPage()
+    {
+        const uint16_t top = page * PageHeight;
+        const uint16_t rows = std::min<uint16_t>(PageHeight, pwH - top);
+        if (inverted)
+            planes.invert();
+        writePlanes(pwX, pwY + top, pwW, rows, secondPhase);
+        if (++page < windowPages())
+        {
+            fillScreen(GxEPD_WHITE);
+            return true;
+        }
+        page = 0;
+        if (secondPhase)
+        {
+            secondPhase = false;
+            return false;
+        }
+        if (partialMode)
+            epd2.refresh(pwX, pwY, pwW, pwH);
+        else
+            epd2.refresh(false);
+        if (!Panel::hasFastPartialUpdate)
+            return false;
+        if (windowPages() == 1)
+        {
+            writePlanes(pwX, pwY, pwW, pwH, true);
+            return false;
+        }
+        secondPhase = true;
+        fillScreen(GxEPD_WHITE);
+        return true;
+    }
+
+    /**
+     * @brief Sends the next frames as their negative, for the ghosting protection
+     * @note Applied to each finished page, the drawing code stays the same
+     */
+    void setInverted(bool on) { inverted = on; }
+
+    void hibernate() { epd2.hibernate(); }
+    void powerOff() { epd2.powerOff(); }
+
+    //=============== DRAWING ===============
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (x < 0 || x >= width() || y < 0 || y >= height())
+            return;
+        switch (getRotation())
+        {
+        case 1:
+            std::swap(x, y);
+            x = Panel::WIDTH - x - 1;
+            break;
+        case 2:
+            x = Panel::WIDTH - x - 1;
+            y = Panel::HEIGHT - y - 1;
+            break;
+        case 3:
+            std::swap(x, y);
+            y = Panel::HEIGHT - y - 1;
+            break;
+        }
+        int16_t row;
+        if (x < pwX || x >= pwX + pwW || !pageRow(y, row))
+            return;
+        x -= pwX;
+        planes.paint(row * planes.rowBytes + x / 8, 0x80 >> (x & 7), inkOf(color));
+    }
+
+    void fillScreen(uint16_t color) override { planes.fill(inkOf(color)); }
+
+    // Like the Adafruit_GFX defaults a line runs from x to x + w - 1, whatever the sign of w
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+    {
+        if (getRotation())
+            return Adafruit_GFX::drawFastHLine(x, y, w, color);
+        fillRows(x, x + w - 1, y, y, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+    {
+        if (getRotation())
+            return Adafruit_GFX::drawFastVLine(x, y, h, color);
+        fillRows(x, x, y, y + h - 1, color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+    {
+        if (getRotation())
+            return Adafruit_GFX::fillRect(x, y, w, h, color);
+        if (w > 0) // one vertical line per column in Adafruit_GFX
+            fillRows(x, x + w - 1, y, y + h - 1, color);
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { drawFastHLine(x, y, w, color); }
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { drawFastVLine(x, y, h, color); }
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override { fillRect(x, y, w, h, color); }
+
+    // The overloads below would hide the other Adafruit_GFX ones (RAM bitmaps, GFXcanvas1)
+    using Adafruit_GFX::drawBitmap;
+
+    /**
+     * @brief Draws the set bits of a 1bpp bitmap, same pixels as Adafruit_GFX::drawBitmap()
+     * @param bitmap PROGMEM or RAM, rows padded to whole bytes, MSB first
+     */
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+    {
+        if (getRotation())
+            return Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+        blit(x, y, bitmap, w, h, inkOf(color), nullptr);
+    }
+
+    /**
+     * @brief Draws a 1bpp bitmap with the clear bits in bg
+     */
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg)
+    {
+        if (getRotation())
+            return Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+        const PlaneInk bgInk = inkOf(bg);
+        blit(x, y, bitmap, w, h, inkOf(color), &bgInk);
+    }
+
+private:
+    static constexpr bool hasRed = Panel::hasColor;
+
+    FramePlanes<Panel::WIDTH, PageHeight, hasRed> planes;
+    bool partialMode;
+    bool secondPhase = false; // writing the pages again for the previous frame buffer
+    bool inverted = false;
+    uint16_t page = 0;
+    uint16_t pwX, pwY, pwW, pwH; // window in panel coordinates
+
+    // White stays white, reddish colours are red where the panel has red, the rest is black
+    static PlaneInk inkOf(uint16_t color)
+    {
+        if (color == GxEPD_WHITE)
+            return {true, true};
+        if (hasRed && (color & 0xf800) > 0x8000)
+            return {true, false};
+        return {false, true};
+    }
+
+    void setWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+        pwX = x;
+        pwY = y;
+        pwW = w;
+        pwH = h;
+        planes.rowBytes = w / 8;
+        page = 0;
+    }
+
+    uint16_t windowPages() const { return (pwH + PageHeight - 1) / PageHeight; }
+
+    // Row in the page buffer of panel row y, false outside the window or the page
+    bool pageRow(int16_t y, int16_t &row) const
+    {
+        row = y - pwY - page * PageHeight;
+        return y >= pwY && y < pwY + pwH && row >= 0 && row < PageHeight;
+    }
+
+    // Rows and columns of the window and the current page, [x0, x1) and [y0, y1) in panel coordinates
+    void clip(int16_t &x0, int16_t &x1, int16_t &y0, int16_t &y1) const
+    {
+        const int16_t top = pwY + page * PageHeight;
+        x0 = std::max<int16_t>(x0, pwX);
+        x1 = std::min<int16_t>(x1, pwX + pwW);
+        y0 = std::max<int16_t>(y0, top);
+        y1 = std::min<int16_t>(y1, std::min<int16_t>(top + PageHeight, pwY + pwH));
+    }
+
+    // Fills the inclusive box between two corners given in any order
+    void fillRows(int16_t xa, int16_t xb, int16_t ya, int16_t yb, uint16_t color)
+    {
+        int16_t x0 = std::min(xa, xb), x1 = std::max(xa, xb) + 1;
+        int16_t y0 = std::min(ya, yb), y1 = std::max(ya, yb) + 1;
+        clip(x0, x1, y0, y1);
+        if (x0 >= x1)
+            return;
+        const PlaneInk ink = inkOf(color);
+        const int16_t top = pwY + page * PageHeight;
+        for (int16_t y = y0; y < y1; y++)
+            planes.fillSpan(y - top, x0 - pwX, x1 - pwX, ink);
+    }
+
+    void blit(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, PlaneInk ink, const PlaneInk *bg)
+    {
+        const uint16_t rowLen = (w + 7) / 8;
+        int16_t x0 = x, x1 = x + w, y0 = y, y1 = y + h;
+        clip(x0, x1, y0, y1);
+        if (x0 >= x1)
+            return;
+        const int16_t top = pwY + page * PageHeight;
+        for (int16_t row = y0; row < y1; row++)
+            planes.blitRow(row - top, x - pwX, bitmap + (row - y) * rowLen, rowLen, x0 - pwX, x1 - pwX, ink, bg);
+    }
+
+    // One band of the window to the controller, again = the previous frame buffer of fast partial panels
+    void writePlanes(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool again)
+    {
+        writePlanes(x, y, w, h, again, std::integral_constant<bool, hasRed>());
+    }
+
+    void writePlanes(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool, std::true_type)
+    {
+        epd2.writeImage(planes.black, planes.red, x, y, w, h);
+    }
+
+    void writePlanes(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool again, std::false_type)
+    {
+        if (again)
+            epd2.writeImageAgain(planes.black, x, y, w, h);
+        else if (!partialMode)
+            writeFullImage(epd2, x, y, w, h, 0);
+        else
+            epd2.writeImage(planes.black, x, y, w, h);
+    }
+
+    // A full refresh of fast partial panels goes through writeImageForFullRefresh(), like
+    // GxEPD2_BW does, on drivers that have it
+    template <typename P>
+    auto writeFullImage(P &panel, uint16_t x, uint16_t y, uint16_t w, uint16_t h, int)
+        -> decltype(panel.writeImageForFullRefresh(planes.black, x, y, w, h), void())
+    {
+        panel.writeImageForFullRefresh(planes.black, x, y, w, h);
+    }
+
+    template <typename P>
+    void writeFullImage(P &panel, uint16_t x, uint16_t y, uint16_t w, uint16_t h, long)
+    {
+        panel.writeImage(planes.black, x, y, w, h);
+    }
+};
+
+#endif
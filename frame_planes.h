@@ -0,0 +1,137 @@
+#ifndef FRAME_PLANES_H
+#define FRAME_PLANES_H
+
+// Page buffer of the display as plain bit planes, with the drawing operations
+// that work on whole bytes. One bit per pixel, MSB on the left, a set bit is
+// white in the black plane and no red in the red plane, the layout the panel
+// RAM uses, so a page goes out as it is. Kept free of Adafruit_GFX, and
+// Arduino.h is only pulled in on the board, so tools/blit_bench.cpp can run
+// it on the PC.
+
+#include <stdint.h>
+#include <string.h>
+#ifdef ARDUINO
+#include <Arduino.h> // pgm_read_byte, the tools define their own
+#endif
+
+/**
+ * @brief Plane bits of one colour, true sets the bit
+ */
+struct PlaneInk
+{
+    bool black; // false paints black
+    bool red;   // false paints red
+};
+
+template <uint16_t Width, uint16_t Rows, bool HasRed>
+struct FramePlanes
+{
+    static constexpr uint16_t BYTES = Width / 8 * Rows;
+
+    alignas(4) uint8_t black[BYTES];
+    alignas(4) uint8_t red[HasRed ? BYTES : 1];
+    uint16_t rowBytes = Width / 8; // of the current window
+
+    void fill(PlaneInk ink)
+    {
+        memset(black, ink.black ? 0xff : 0x00, sizeof(black));
+        if (HasRed)
+            memset(red, ink.red ? 0xff : 0x00, sizeof(red));
+    }
+
+    /**
+     * @brief Turns the page into its negative, a word at a time
+     * @note Black and white swap and red turns white, so the panel only
+     *       drives black and white particles while it clears ghosting
+     */
+    void invert()
+    {
+        const uint16_t words = BYTES / 4;
+        for (uint16_t i = 0; i < words; i++)
+        {
+            uint32_t b, r = 0xffffffff;
+            memcpy(&b, black + 4 * i, 4);
+            if (HasRed)
+                memcpy(&r, red + 4 * i, 4);
+            b = ~(b & r); // white where it was black or red
+            memcpy(black + 4 * i, &b, 4);
+        }
+        for (uint16_t i = 4 * words; i < BYTES; i++)
+            black[i] = HasRed ? ~(black[i] & red[i]) : ~black[i];
+        if (HasRed)
+            memset(red, 0xff, sizeof(red));
+    }
+
+    // Sets or clears the mask bits of byte i in both planes
+    void paint(uint16_t i, uint8_t mask, PlaneInk ink)
+    {
+        black[i] = ink.black ? black[i] | mask : black[i] & ~mask;
+        if (HasRed)
+            red[i] = ink.red ? red[i] | mask : red[i] & ~mask;
+    }
+
+    /**
+     * @brief Paints columns x0 to x1 - 1 of one row
+     * @note Columns are relative to the window and already clipped
+     */
+    void fillSpan(int16_t row, int16_t x0, int16_t x1, PlaneInk ink)
+    {
+        const uint16_t start = row * rowBytes;
+        const int16_t first = x0 >> 3, last = (x1 - 1) >> 3;
+        const uint8_t headMask = 0xff >> (x0 & 7);
+        const uint8_t tailMask = 0xff << (7 - ((x1 - 1) & 7));
+        if (first == last)
+        {
+            paint(start + first, headMask & tailMask, ink);
+            return;
+        }
+        paint(start + first, headMask, ink);
+        memset(black + start + first + 1, ink.black ? 0xff : 0x00, last - first - 1);
+        if (HasRed)
+            memset(red + start + first + 1, ink.red ? 0xff : 0x00, last - first - 1);
+        paint(start + last, tailMask, ink);
+    }
+
+    /**
+     * @brief Paints one row of a 1bpp bitmap, a destination byte at a time
+     * @param row Row in the page
+     * @param x Column of the first bitmap pixel, may be outside the clip
+     * @param bits Bitmap row, MSB first, PROGMEM or RAM
+     * @param rowLen Bytes of the bitmap row
+     * @param x0 First column to draw, clipped to the window
+     * @param x1 Column after the last one to draw
+     * @param ink Colour of the set bits
+     * @param bg Colour of the clear bits, nullptr leaves them transparent
+     * @note When x is a multiple of 8 each destination byte is one source
+     *       byte, otherwise two neighbouring source bytes are shifted together
+     */
+    void blitRow(int16_t row, int16_t x, const uint8_t *bits, uint16_t rowLen, int16_t x0, int16_t x1,
+                 PlaneInk ink, const PlaneInk *bg)
+    {
+        const uint16_t start = row * rowBytes;
+        const uint8_t shift = x & 7;
+        for (int16_t d = x0 >> 3; d <= (x1 - 1) >> 3; d++)
+        {
+            // source byte under the first column of destination byte d, negative left of the bitmap
+            const int16_t k = (d * 8 - x) >> 3;
+            const uint8_t left = k >= 0 && k < rowLen ? pgm_read_byte(bits + k) : 0;
+            uint8_t src = left;
+            if (shift)
+            {
+                const uint8_t right = k + 1 >= 0 && k + 1 < rowLen ? pgm_read_byte(bits + k + 1) : 0;
+                src = left << (8 - shift) | right >> shift;
+            }
+
+            uint8_t mask = 0xff;
+            if (d * 8 < x0)
+                mask &= 0xff >> (x0 - d * 8);
+            if (d * 8 + 8 > x1)
+                mask &= 0xff << (d * 8 + 8 - x1);
+            paint(start + d, src & mask, ink);
+            if (bg)
+                paint(start + d, ~src & mask, *bg);
+        }
+    }
+};
+
+#endif
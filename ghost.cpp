@@ -0,0 +1,59 @@
+#include "ghost.h"
+
+static RTC_DATA_ATTR uint32_t tileHashes[WIDGET_COUNT]; // content of each region at the last refresh
+static RTC_DATA_ATTR uint32_t tileSince[WIDGET_COUNT];  // RTC unixtime it last changed, 0 = unknown
+static RTC_DATA_ATTR uint16_t ghostRisk = 0;           // accumulated since the last clean cycle
+static RTC_DATA_ATTR uint8_t refreshesSinceClean = 0;
+
+/**
+ * @brief Tells whether the next frame should be the inverted one of a clean cycle
+ * @param policy Thresholds of the scheduler
+ * @return bool true when the accumulated risk or the refresh count crossed its limit
+ */
+bool ghostCleanDue(const GhostPolicy &policy)
+{
+    const bool due = refreshesSinceClean >= policy.maxRefreshes ||
+                     (ghostRisk >= policy.threshold && refreshesSinceClean >= policy.minRefreshes);
+    if (due)
+        Serial.printf("Ghosting: clean cycle, risk %u/%u after %u refreshes\n", ghostRisk, policy.threshold,
+                      refreshesSinceClean);
+    return due;
+}
+
+/**
+ * @brief Accounts for a frame that reached the panel, call after the refresh
+ * @param policy Thresholds of the scheduler
+ * @param now RTC unixtime
+ * @param tiles One hash per Widget, nullptr when the frame is not the weather layout
+ * @param partial true for a partial refresh
+ * @param clean true for the inverted frame of a clean cycle, starts counting again
+ */
+void ghostRecord(const GhostPolicy &policy, uint32_t now, const uint32_t *tiles, bool partial, bool clean)
+{
+    uint16_t tileRisk = 0;
+    for (byte i = 0; i < WIDGET_COUNT; i++)
+    {
+        // Other layouts cover every region, so they count as changed
+        if (!tiles || tiles[i] != tileHashes[i] || tileSince[i] == 0 || clean)
+        {
+            tileHashes[i] = tiles ? tiles[i] : 0;
+            tileSince[i] = now;
+            continue;
+        }
+        const uint32_t points = (now - tileSince[i]) / policy.staticStep;
+        tileRisk += points < policy.maxTileRisk ? points : policy.maxTileRisk;
+    }
+
+    if (clean)
+    {
+        ghostRisk = 0;
+        refreshesSinceClean = 0;
+        return;
+    }
+    const uint8_t refreshRisk = partial ? policy.partialRisk : policy.fullRisk;
+    ghostRisk = min<uint32_t>(ghostRisk + refreshRisk + tileRisk, UINT16_MAX);
+    if (refreshesSinceClean < UINT8_MAX)
+        refreshesSinceClean++;
+    Serial.printf("Ghosting: risk %u/%u after %u refreshes (+%u refresh, +%u static regions)\n", ghostRisk,
+                  policy.threshold, refreshesSinceClean, refreshRisk, tileRisk);
+}
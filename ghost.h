@@ -0,0 +1,28 @@
+#ifndef GHOST_H
+#define GHOST_H
+
+// Ghosting scheduler. E-paper ghosting builds up with every refresh, more so
+// with partial ones, and where a region keeps the same image for a long
+// time. The risk is accumulated across deep sleep in RTC memory, with the
+// static time of each region of the weather layout (tracked through the
+// widget hashes), and a clean cycle (one inverted frame, the next wake draws
+// it normal again with a full refresh) runs only when it crosses a threshold.
+
+#include <Arduino.h>
+#include "layout.h" // WIDGET_COUNT
+
+struct GhostPolicy
+{
+    uint16_t threshold;   // risk that triggers a clean cycle
+    uint8_t fullRisk;     // added by every full refresh
+    uint8_t partialRisk;  // added by every partial refresh
+    uint16_t staticStep;  // seconds a region has to stay unchanged per point it adds to each refresh
+    uint8_t maxTileRisk;  // most points one region adds to a refresh
+    uint8_t minRefreshes; // refreshes between two clean cycles at least
+    uint8_t maxRefreshes; // clean cycle after this many refreshes whatever the risk
+};
+
+bool ghostCleanDue(const GhostPolicy &policy);
+void ghostRecord(const GhostPolicy &policy, uint32_t now, const uint32_t *tiles, bool partial, bool clean);
+
+#endif
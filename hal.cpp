@@ -0,0 +1,626 @@
+#include "hal.h"
+
+#include <Wire.h>
+#include <SparkFun_TMP117.h>
+#include <Adafruit_Sensor.h>
+#include "Adafruit_BME680.h"
+#include <BH1750.h>
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include <NTPClient.h>
+#include <WiFiUdp.h>
+#include <Preferences.h>
+#include "http_exchange.h"
+#include "perf.h" // /perf page of the setup portal
+#include <esp_timer.h>
+#include <mutex>
+
+// Hardware pins
+#define BATPIN A0    // Battery voltage divider pin (1M Ohm with 104 Capacitor)
+#define DEBUG_PIN D6 // Debug mode toggle pin
+
+#define WIFI_FAST_TIMEOUT_MS 3000 // cached join, a scan follows if it takes longer
+#define HTTP_TIMEOUT_MS 10000     // whole fetch, stalled requests are dropped after this
+#define DNS_CACHE_SIZE 4          // hosts remembered across deep sleep
+#define DNS_TTL_S 21600           // 6 h, re-resolve after this even if connecting works
+
+static Preferences pref;
+static RTC_DS3231 rtc;          // Initalize rtc
+static TMP117 sensor;           // Initalize temperature sensor
+static Adafruit_BME680 bme;     // Initalize environmental sensor
+static BH1750 lightMeter(0x23); // Initalize light sensor
+
+EpdPanel halPanel()
+{
+    return EpdPanel(/*CS=5*/ /* SS*/ D7, /*DC=*/D1, /*RST=*/D2, /*BUSY=*/D3);
+}
+
+void halNvsBegin()
+{
+    pref.begin("database", false); // Open the preferences "database"
+}
+
+void halNvsEnd()
+{
+    pref.end();
+}
+
+bool halNvsHas(const char *key)
+{
+    return pref.isKey(key);
+}
+
+bool halNvsGetBool(const char *key, bool fallback)
+{
+    return pref.getBool(key, fallback);
+}
+
+void halNvsPutBool(const char *key, bool value)
+{
+    pref.putBool(key, value);
+}
+
+uint8_t halNvsGetUChar(const char *key, uint8_t fallback)
+{
+    return pref.getUChar(key, fallback);
+}
+
+void halNvsPutUChar(const char *key, uint8_t value)
+{
+    pref.putUChar(key, value);
+}
+
+float halNvsGetFloat(const char *key, float fallback)
+{
+    return pref.getFloat(key, fallback);
+}
+
+void halNvsPutFloat(const char *key, float value)
+{
+    pref.putFloat(key, value);
+}
+
+String halNvsGetString(const char *key, const char *fallback)
+{
+    return pref.getString(key, fallback);
+}
+
+void halNvsPutString(const char *key, const char *value)
+{
+    pref.putString(key, value);
+}
+
+void halSetCpuMhz(uint32_t mhz)
+{
+    if (getCpuFrequencyMhz() != mhz)
+        setCpuFrequencyMhz(mhz);
+}
+
+uint32_t halCpuMhz()
+{
+    return getCpuFrequencyMhz();
+}
+
+bool halDebugSwitch()
+{
+    pinMode(DEBUG_PIN, INPUT);
+    return digitalRead(DEBUG_PIN) == 1;
+}
+
+void halDeepSleep(uint32_t seconds)
+{
+    esp_sleep_enable_timer_wakeup(seconds * 1000000ULL); // Set the sleep time
+    esp_deep_sleep_start();
+}
+
+void halRestart()
+{
+    ESP.restart();
+}
+
+int64_t halMicros()
+{
+    return esp_timer_get_time();
+}
+
+uint32_t halMinFreeHeap()
+{
+    return ESP.getMinFreeHeap();
+}
+
+void halBusBegin()
+{
+    Wire.begin();          // Start the I2C communication
+    Wire.setClock(400000); // Set clock speed to be the fastest for better communication (fast mode)
+}
+
+void halBusEnd()
+{
+    Wire.end(); // End I2C communication
+}
+
+bool halLightBegin()
+{
+    return lightMeter.begin(BH1750::ONE_TIME_HIGH_RES_MODE);
+}
+
+// Blocks until the one-shot conversion started by halLightBegin() is ready
+float halReadLux()
+{
+    while (!lightMeter.measurementReady(true))
+    {
+        yield(); // Wait for the measurement to be ready
+    }
+    return lightMeter.readLightLevel();
+}
+
+bool halRtcBegin()
+{
+    return rtc.begin();
+}
+
+DateTime halNow()
+{
+    return rtc.now();
+}
+
+void halRtcAdjust(const DateTime &dt)
+{
+    rtc.adjust(dt);
+}
+
+bool halIndoorTempBegin()
+{
+    // checks that the TMP117 self-identifies with the proper Device ID/Address
+    return sensor.begin();
+}
+
+bool halReadIndoorTemp(float &tempC)
+{
+    if (!sensor.dataReady())
+        return false;
+    tempC = sensor.readTempC();
+    return true;
+}
+
+bool halEnvBegin()
+{
+    if (!bme.begin())
+        return false;
+
+    // Set up oversampling and filter initialization
+    bme.setTemperatureOversampling(BME680_OS_2X);
+    bme.setHumidityOversampling(BME680_OS_16X);
+    bme.setPressureOversampling(BME680_OS_16X);
+    bme.setIIRFilterSize(BME680_FILTER_SIZE_7);
+    bme.setGasHeater(0, 0); // 0*C for 0 ms
+    return true;
+}
+
+// pressure is returned in hPa
+bool halReadEnv(float &humidity, float &pressure)
+{
+    if (!bme.beginReading() || !bme.endReading())
+        return false;
+    humidity = bme.humidity;
+    pressure = bme.pressure / 100.0;
+    return true;
+}
+
+void halAdcBegin()
+{
+    pinMode(BATPIN, INPUT);
+    analogReadResolution(12); // Set ADC resolution to 12-bit
+}
+
+uint32_t halBatteryMilliVolts()
+{
+    return analogReadMilliVolts(BATPIN); // ADC with correction
+}
+
+// Access point and lease of the last successful connection
+struct WifiLease
+{
+    char ssid[33]; // empty when nothing is cached
+    uint8_t bssid[6];
+    int32_t channel;
+    uint32_t ip, gateway, mask, dns;
+    uint32_t obtained; // DS3231 time of the DHCP join that gave the lease
+};
+
+static RTC_DATA_ATTR WifiLease wifiLease;
+
+// Keeps the access point and lease of a DHCP join
+static void saveLease(const char *ssid)
+{
+    WifiLease lease;
+    memset(&lease, 0, sizeof(lease));
+    strlcpy(lease.ssid, ssid, sizeof(lease.ssid));
+    memcpy(lease.bssid, WiFi.BSSID(), sizeof(lease.bssid));
+    lease.channel = WiFi.channel();
+    lease.ip = WiFi.localIP();
+    lease.gateway = WiFi.gatewayIP();
+    lease.mask = WiFi.subnetMask();
+    lease.dns = WiFi.dnsIP();
+    lease.obtained = halNow().unixtime();
+    if (memcmp(&lease, &wifiLease, sizeof(lease)) != 0)
+    {
+        wifiLease = lease;
+        pref.putBytes("wifiLease", &wifiLease, sizeof(wifiLease));
+    }
+}
+
+HalWifiResult halWifiConnect(const char *ssid, const char *password)
+{
+    WiFi.mode(WIFI_STA);
+
+    // RTC memory is lost on power loss, fall back to the NVS copy
+    if (wifiLease.ssid[0] == '\0' && pref.getBytes("wifiLease", &wifiLease, sizeof(wifiLease)) != sizeof(wifiLease))
+        wifiLease.ssid[0] = '\0';
+
+    if (wifiLease.ssid[0] != '\0' && strcmp(wifiLease.ssid, ssid) == 0)
+    {
+        // The router may hand the address to someone else once its lease
+        // runs out, so an old lease is renewed with DHCP on the cached channel.
+        // A clock set backwards also counts as old.
+        const bool reuse = WIFI_REUSE_LEASE && halNow().unixtime() - wifiLease.obtained < WIFI_LEASE_MAX_AGE_S;
+        if (reuse)
+            WiFi.config(IPAddress(wifiLease.ip), IPAddress(wifiLease.gateway), IPAddress(wifiLease.mask), IPAddress(wifiLease.dns));
+        WiFi.begin(ssid, password, wifiLease.channel, wifiLease.bssid);
+        if (WiFi.waitForConnectResult(WIFI_FAST_TIMEOUT_MS) == WL_CONNECTED)
+        {
+            if (!reuse)
+                saveLease(ssid);
+            return HAL_WIFI_CACHED;
+        }
+
+        // AP moved to another channel or the lease is gone, start over with DHCP
+        WiFi.disconnect();
+        WiFi.config(IPAddress(), IPAddress(), IPAddress());
+    }
+
+    WiFi.begin(ssid, password);
+    if (WiFi.waitForConnectResult() != WL_CONNECTED)
+        return HAL_WIFI_FAILED;
+    saveLease(ssid);
+    return HAL_WIFI_SCANNED;
+}
+
+bool halWifiConnected()
+{
+    return WiFi.status() == WL_CONNECTED;
+}
+
+int8_t halWifiRssi()
+{
+    return WiFi.RSSI();
+}
+
+void halWifiSsid(char *out, size_t len)
+{
+    strlcpy(out, WiFi.SSID().c_str(), len);
+}
+
+String halWifiLocalIp()
+{
+    return WiFi.localIP().toString();
+}
+
+void halWifiOff()
+{
+    WiFi.disconnect(true); // Disconnect and clear credentials
+    WiFi.mode(WIFI_OFF);   // Set WiFi mode to off
+    esp_wifi_stop();
+
+    // Additional power savings
+    btStop(); // Disable Bluetooth - more compatible than esp_bt_controller_disable()
+}
+
+// Setup portal, only started while no credentials are stored
+static AsyncWebServer server(80);
+
+// Search for parameter in HTTP POST request
+static const char *PARAM_INPUT_1 = "ssid";
+static const char *PARAM_INPUT_2 = "pass";
+
+String halWifiPortalBegin(const char *apName, const char *page)
+{
+    // NULL sets an open Access Point
+    WiFi.softAP(apName, NULL);
+
+    // Web Server Root URL
+    server.on("/", HTTP_GET, [page](AsyncWebServerRequest *request)
+              { request->send(200, "text/html", page); });
+
+    // Timing of the last wake cycles
+    server.on("/perf", HTTP_GET, [](AsyncWebServerRequest *request)
+              { request->send(200, "text/plain", perfReport()); });
+
+    server.on("/", HTTP_POST, [](AsyncWebServerRequest *request)
+              {
+        int params = request->params();
+        for (int i = 0; i < params; i++) {
+          const AsyncWebParameter *p = request->getParam(i);
+          if (p->isPost()) {
+            // HTTP POST ssid value
+            if (p->name() == PARAM_INPUT_1) {
+              String ssid = p->value();
+              Serial.print("SSID set to: ");
+              Serial.println(ssid);
+              ssid.trim();
+              pref.putString("ssid", ssid);
+            }
+            // HTTP POST pass value
+            if (p->name() == PARAM_INPUT_2) {
+              String password = p->value();
+              Serial.print("Password set to: ");
+              Serial.println(password);
+              password.trim();
+              pref.putString("password", password);
+            }
+            //Serial.printf("POST[%s]: %s\n", p->name().c_str(), p->value().c_str());
+          }
+        }
+        request->send(200, "text/html", "<h2>Done. Weather Station will now restart</h2>");
+        delay(3000);
+        ESP.restart(); });
+    server.begin();
+    return WiFi.softAPIP().toString();
+}
+
+void halWifiPortalWait()
+{
+    while (true)
+        ; // the AsyncTCP task serves the page and restarts the board
+}
+
+bool halNtpTime(const char *server, long utcOffset, DateTime &now)
+{
+    if (WiFi.status() != WL_CONNECTED)
+        return false;
+    WiFiUDP ntpUDP;
+    NTPClient timeClient(ntpUDP, server, utcOffset);
+    timeClient.begin();
+    bool ok = timeClient.update() && timeClient.isTimeSet();
+    if (ok)
+        now = DateTime(timeClient.getEpochTime());
+    timeClient.end();
+    return ok;
+}
+
+// Requests are written by hand as HTTP/1.0 so the body is never chunked and
+// can go straight from the socket to the sink. All callbacks run in the
+// AsyncTCP task, setup() only starts the requests and waits. A fetch is
+// finished from either task, so its state changes under fetchLock.
+
+// Resolved host, survives deep sleep in RTC memory
+struct DnsEntry
+{
+    char host[48];
+    uint32_t ip;
+    uint32_t expires;  // RTC unixtime, 0 for a free slot
+    uint32_t lookupUs; // what resolving it took, reported as saved on a hit
+};
+
+static RTC_DATA_ATTR DnsEntry dnsCache[DNS_CACHE_SIZE];
+
+// State of one request, owned by the AsyncTCP task until closed is set
+struct HttpFetch
+{
+    HttpRequest *request;
+    AsyncClient client;
+    HttpExchange exchange;
+    DnsEntry *dns; // cache slot the address came from, null when not cached
+    int64_t start;
+    volatile bool connected;
+    volatile bool timedOut;
+    volatile bool done;
+    volatile bool closed;
+    bool attached; // callbacks may still use it
+};
+
+// Recursive, close() runs the disconnect callback in the calling task
+static std::recursive_mutex fetchLock;
+
+// Static so a callback the AsyncTCP task had already picked up when the
+// callbacks were detached still finds valid memory, attached turns it away
+static HttpFetch fetches[HTTP_MAX_REQUESTS];
+
+/**
+ * @brief Looks the host up in the RTC cache, resolving and storing it on a miss
+ * @param f Request to resolve, dns is set to the cache slot used
+ * @param ip Resolved address
+ * @return bool false when the name could not be resolved
+ */
+static bool resolveHost(HttpFetch &f, IPAddress &ip)
+{
+    uint32_t now = halNow().unixtime();
+    DnsEntry *slot = &dnsCache[0];
+    for (DnsEntry &e : dnsCache)
+    {
+        if (e.expires != 0 && strcmp(e.host, f.exchange.host()) == 0)
+        {
+            if (now < e.expires)
+            {
+                ip = IPAddress(e.ip);
+                f.dns = &e;
+                f.request->dnsSavedUs = e.lookupUs;
+                return true;
+            }
+            slot = &e; // expired, refresh in place
+            break;
+        }
+        if (e.expires < slot->expires)
+            slot = &e; // free or oldest slot
+    }
+
+    int64_t start = halMicros();
+    bool ok = WiFi.hostByName(f.exchange.host(), ip) == 1;
+    f.request->dnsUs = halMicros() - start;
+    if (!ok || strlen(f.exchange.host()) >= sizeof(slot->host))
+        return ok;
+
+    strcpy(slot->host, f.exchange.host());
+    slot->ip = ip;
+    slot->expires = now + DNS_TTL_S;
+    slot->lookupUs = f.request->dnsUs;
+    f.dns = slot;
+    return true;
+}
+
+// Caller holds fetchLock
+static void fetchFinish(HttpFetch &f)
+{
+    if (f.done)
+        return;
+    f.exchange.finish(f.timedOut);
+    f.request->latencyUs = halMicros() - f.start;
+    f.done = true;
+}
+
+static void onFetchConnect(void *arg, AsyncClient *client)
+{
+    HttpFetch &f = *static_cast<HttpFetch *>(arg);
+    std::lock_guard<std::recursive_mutex> hold(fetchLock);
+    if (!f.attached)
+        return;
+    f.connected = true;
+    char req[640];
+    f.exchange.requestText(req, sizeof(req));
+    client->write(req);
+}
+
+static void onFetchData(void *arg, AsyncClient *client, void *data, size_t len)
+{
+    HttpFetch &f = *static_cast<HttpFetch *>(arg);
+    std::lock_guard<std::recursive_mutex> hold(fetchLock);
+    if (!f.attached || f.done)
+        return;
+    if (!f.exchange.receive(static_cast<const uint8_t *>(data), len))
+    {
+        fetchFinish(f);
+        client->close();
+    }
+}
+
+static void onFetchDisconnect(void *arg, AsyncClient *client)
+{
+    HttpFetch &f = *static_cast<HttpFetch *>(arg);
+    std::lock_guard<std::recursive_mutex> hold(fetchLock);
+    if (!f.attached)
+        return;
+    fetchFinish(f);
+    f.closed = true;
+}
+
+// Connect failures end here without a disconnect
+static void onFetchError(void *arg, AsyncClient *client, int8_t error)
+{
+    HttpFetch &f = *static_cast<HttpFetch *>(arg);
+    std::lock_guard<std::recursive_mutex> hold(fetchLock);
+    if (!f.attached)
+        return;
+    if (f.request->code == 0)
+        f.request->code = HTTP_ERROR_CONNECTION_REFUSED;
+    fetchFinish(f);
+    if (!client->connected())
+        f.closed = true;
+}
+
+static void onFetchTimeout(void *arg, AsyncClient *client, uint32_t time)
+{
+    HttpFetch &f = *static_cast<HttpFetch *>(arg);
+    {
+        std::lock_guard<std::recursive_mutex> hold(fetchLock);
+        if (!f.attached)
+            return;
+        f.timedOut = true;
+    }
+    client->close();
+}
+
+void halHttpGetAll(HttpRequest *requests, size_t count)
+{
+    count = min(count, (size_t)HTTP_MAX_REQUESTS);
+    int64_t start = halMicros();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        HttpFetch &f = fetches[i];
+        f.request = &requests[i];
+        f.request->code = 0;
+        f.request->latencyUs = 0;
+        f.request->dnsUs = 0;
+        f.request->dnsSavedUs = 0;
+        f.request->bodyBytes = 0;
+        f.dns = nullptr;
+        f.start = start;
+        f.connected = false;
+        f.timedOut = false;
+        f.done = false;
+        f.closed = false;
+        f.attached = true;
+
+        f.client.onConnect(onFetchConnect, &f);
+        f.client.onData(onFetchData, &f);
+        f.client.onDisconnect(onFetchDisconnect, &f);
+        f.client.onError(onFetchError, &f);
+        f.client.onTimeout(onFetchTimeout, &f);
+        f.client.setRxTimeout(HTTP_TIMEOUT_MS / 1000);
+
+        // Connect by address, the Host header still carries the name
+        IPAddress ip;
+        if (!f.exchange.begin(*f.request) || !resolveHost(f, ip) || !f.client.connect(ip, f.exchange.port()))
+        {
+            std::lock_guard<std::recursive_mutex> hold(fetchLock);
+            f.request->code = HTTP_ERROR_CONNECTION_REFUSED;
+            f.done = true;
+            f.closed = true;
+        }
+    }
+
+    // Wait for every response, the AsyncTCP task does the work
+    for (;;)
+    {
+        bool pending = false;
+        for (size_t i = 0; i < count; i++)
+            pending |= !fetches[i].done;
+        if (!pending || halMicros() - start > HTTP_TIMEOUT_MS * 1000LL)
+            break;
+        delay(1);
+    }
+
+    // Stragglers count as timed out, close() may run their disconnect
+    // callback right here so fetchLock is not held around it
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!fetches[i].closed)
+        {
+            fetches[i].timedOut = true;
+            fetches[i].client.close(true);
+        }
+    }
+    int64_t closeStart = halMicros();
+    for (size_t i = 0; i < count; i++)
+    {
+        HttpFetch &f = fetches[i];
+        while (!f.closed && halMicros() - closeStart < 500000)
+            delay(1);
+
+        // Nothing may call back into a finished request, closed or not
+        std::lock_guard<std::recursive_mutex> hold(fetchLock);
+        f.client.onConnect(nullptr, nullptr);
+        f.client.onData(nullptr, nullptr);
+        f.client.onDisconnect(nullptr, nullptr);
+        f.client.onError(nullptr, nullptr);
+        f.client.onTimeout(nullptr, nullptr);
+        f.attached = false;
+        fetchFinish(f);
+
+        // The host may have moved, resolve it again next wake
+        if (!f.connected && f.dns)
+            f.dns->expires = 0;
+    }
+}
@@ -0,0 +1,192 @@
+#ifndef HAL_H
+#define HAL_H
+
+// Thin hardware abstraction layer for the weather clock.
+// The sketch talks to the panel, the I2C sensors, the RTC, the battery ADC,
+// WiFi, HTTP, NVS and the power states only through this header, so the wake
+// cycle can be retargeted (other panels, other boards, mocked peripherals)
+// without touching setup(). hal.cpp is the ESP32 backend, tools/host has a
+// PC backend (HAL_HOST) that runs the same setup() against mocks.
+
+#include <Arduino.h>
+#include "epd_frame.h"
+#include "http_request.h"
+#include "RTClib.h"
+
+//=============== DISPLAY SINK ===============
+#ifdef HAL_HOST
+#include "host_panel.h" // controller RAM dumped as PBM files
+typedef HostPanel EpdPanel;
+#else
+#include <GxEPD2_3C.h>
+typedef GxEPD2_420c_Z21 EpdPanel; // 400x300, UC8276, change here to retarget the display
+#endif
+
+// Number of horizontal bands the frame is drawn in. 1 keeps both 400x300
+// bit planes (~30 KB) in RAM for the whole wake, 4 or 6 cut that to a band
+// and run the render code once per band (see GxEPD2_display_selection_new_style.h)
+#define EPD_PAGE_BANDS 1
+
+#define MAX_DISPLAY_BUFFER_SIZE (2ul * (EpdPanel::WIDTH / 8) * ((EpdPanel::HEIGHT + EPD_PAGE_BANDS - 1) / EPD_PAGE_BANDS))
+#define MAX_HEIGHT(EPD) (EPD::HEIGHT <= (MAX_DISPLAY_BUFFER_SIZE / 2) / (EPD::WIDTH / 8) ? EPD::HEIGHT : (MAX_DISPLAY_BUFFER_SIZE / 2) / (EPD::WIDTH / 8))
+
+// Paged display class used by the render code
+typedef EpdFrame<EpdPanel, MAX_HEIGHT(EpdPanel)> EpdDisplay;
+
+#undef MAX_DISPLAY_BUFFER_SIZE
+#undef MAX_HEIGHT
+
+/**
+ * @brief Panel driver on the board's SPI pins
+ * @return EpdPanel Driver to hand to EpdDisplay
+ */
+EpdPanel halPanel();
+
+//=============== NVS ===============
+// Values that survive power loss (Preferences namespace "database" on the
+// board). Reads and writes are valid between halNvsBegin() and halNvsEnd(),
+// a put goes to flash right away.
+void halNvsBegin();
+void halNvsEnd();
+bool halNvsHas(const char *key);
+bool halNvsGetBool(const char *key, bool fallback);
+void halNvsPutBool(const char *key, bool value);
+uint8_t halNvsGetUChar(const char *key, uint8_t fallback);
+void halNvsPutUChar(const char *key, uint8_t value);
+float halNvsGetFloat(const char *key, float fallback);
+void halNvsPutFloat(const char *key, float value);
+String halNvsGetString(const char *key, const char *fallback);
+void halNvsPutString(const char *key, const char *value);
+
+//=============== BOARD ===============
+/**
+ * @brief Changes the CPU clock, no-op when it already runs at that speed
+ * @param mhz 20 while only sensors and the panel are used, 80 for WiFi
+ */
+void halSetCpuMhz(uint32_t mhz);
+uint32_t halCpuMhz();
+
+/**
+ * @brief Reads the debug switch
+ * @return bool true when the board is jumpered for debug mode
+ */
+bool halDebugSwitch();
+
+/**
+ * @brief Powers down until the timer wakes the board, setup() runs again then
+ * @param seconds Sleep time
+ * @note Only RTC_DATA_ATTR variables and NVS keep their values
+ */
+void halDeepSleep(uint32_t seconds);
+
+/**
+ * @brief Reboots, RTC_DATA_ATTR variables start over as well
+ */
+void halRestart();
+
+//=============== TIMING ===============
+/**
+ * @brief Monotonic time since boot
+ * @return int64_t Microseconds, keeps counting across CPU frequency changes
+ */
+int64_t halMicros();
+
+/**
+ * @brief Lowest free heap seen since boot
+ * @return uint32_t Bytes
+ */
+uint32_t halMinFreeHeap();
+
+//=============== I2C BUS AND SENSORS ===============
+void halBusBegin();
+void halBusEnd();
+
+bool halLightBegin();
+float halReadLux();
+
+bool halRtcBegin();
+DateTime halNow();
+void halRtcAdjust(const DateTime &dt);
+
+bool halIndoorTempBegin();
+bool halReadIndoorTemp(float &tempC);
+
+bool halEnvBegin();
+bool halReadEnv(float &humidity, float &pressure);
+
+//=============== ADC ===============
+void halAdcBegin();
+uint32_t halBatteryMilliVolts();
+
+//=============== WIFI ===============
+// 1 reuses the last DHCP lease as a static address on fast reconnects,
+// 0 keeps DHCP and only skips the channel scan
+#define WIFI_REUSE_LEASE 1
+// A reused lease is renewed with DHCP once it is this old, keep it below
+// the lease time of the router
+#define WIFI_LEASE_MAX_AGE_S (12 * 3600UL)
+
+enum HalWifiResult : uint8_t
+{
+    HAL_WIFI_FAILED,  // no connection
+    HAL_WIFI_CACHED,  // joined the remembered access point directly
+    HAL_WIFI_SCANNED, // cached join failed or nothing cached, full scan used
+};
+
+/**
+ * @brief Joins the network, trying the last BSSID, channel and lease first
+ * @param ssid Network name
+ * @param password Network password
+ * @return HalWifiResult How the connection was made
+ * @note The access point details live in RTC memory with an NVS copy for
+ *       cold boots, they are rewritten only when they change
+ */
+HalWifiResult halWifiConnect(const char *ssid, const char *password);
+
+bool halWifiConnected();
+int8_t halWifiRssi();
+void halWifiSsid(char *out, size_t len);
+String halWifiLocalIp();
+
+/**
+ * @brief Turns the radio and Bluetooth off for the rest of the wake
+ */
+void halWifiOff();
+
+/**
+ * @brief Opens an access point serving the WiFi setup page
+ * @param apName Name of the open network to join from a phone
+ * @param page HTML form that posts "ssid" and "pass" to /
+ * @return String Address of the page
+ * @note /perf serves perfReport()
+ */
+String halWifiPortalBegin(const char *apName, const char *page);
+
+/**
+ * @brief Serves the setup page until the credentials are posted, never returns
+ * @note They are stored as the NVS keys "ssid" and "password", then the board restarts
+ */
+void halWifiPortalWait();
+
+/**
+ * @brief Reads the time from an NTP server
+ * @param server Host name of the server or pool
+ * @param utcOffset Seconds east of UTC added to the result
+ * @param now Set to the local time
+ * @return bool false without WiFi or without an answer
+ */
+bool halNtpTime(const char *server, long utcOffset, DateTime &now);
+
+//=============== HTTP ===============
+/**
+ * @brief Runs several HTTP GETs at the same time and waits for all of them
+ * @param requests Up to HTTP_MAX_REQUESTS requests, code and latencyUs are filled in
+ * @param count Number of requests
+ * @note Bodies are handed to the sinks while they arrive and never held in
+ *       RAM as a whole. The sinks of different requests never run at once.
+ *       Resolved addresses are kept in RTC memory across deep sleep.
+ *       A compressed request holds a 32 KB inflate window while it runs.
+ */
+void halHttpGetAll(HttpRequest *requests, size_t count);
+
+#endif
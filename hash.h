@@ -0,0 +1,32 @@
+#ifndef HASH_H
+#define HASH_H
+
+// FNV-1a, used to fingerprint what a frame or a widget shows so unchanged
+// content can skip the panel refresh. Values are hashed one at a time,
+// never whole structs, so padding bytes do not leak into the result.
+
+#include <Arduino.h>
+
+#define HASH_INIT 2166136261u
+
+inline uint32_t hashBytes(uint32_t h, const void *data, size_t len)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    while (len--)
+        h = (h ^ *p++) * 16777619u;
+    return h;
+}
+
+// Hashes up to and including the terminator, bytes after it are ignored
+inline uint32_t hashStr(uint32_t h, const char *s)
+{
+    return hashBytes(h, s, strlen(s) + 1);
+}
+
+template <typename T>
+inline uint32_t hashValue(uint32_t h, T value)
+{
+    return hashBytes(h, &value, sizeof(value));
+}
+
+#endif
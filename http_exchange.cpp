@@ -0,0 +1,160 @@
+#include "http_exchange.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+// Copies a header value without the leading blanks, values that do not fit are dropped
+static void copyHeaderValue(const char *value, char *out, size_t len)
+{
+    while (*value == ' ')
+        value++;
+    if (strlen(value) < len)
+        strcpy(out, value);
+}
+
+bool HttpExchange::begin(HttpRequest &request)
+{
+    this->request = &request;
+    request.code = 0;
+    request.bodyBytes = 0;
+    lineLen = 0;
+    inBody = false;
+    remaining = -1;
+    inflating = false;
+    stopped = false;
+
+    // Splits http://host[:port]/path, the path points into url
+    const char *url = request.url;
+    if (strncmp(url, "http://", 7) != 0)
+        return false;
+    url += 7;
+    const char *slash = strchr(url, '/');
+    path = slash ? slash : "/";
+    size_t hostLen = slash ? slash - url : strlen(url);
+    if (hostLen == 0 || hostLen >= sizeof(hostName))
+        return false;
+    memcpy(hostName, url, hostLen);
+    hostName[hostLen] = '\0';
+    hostPort = 80;
+    char *colon = strchr(hostName, ':');
+    if (colon)
+    {
+        *colon = '\0';
+        hostPort = atoi(colon + 1);
+    }
+    return true;
+}
+
+size_t HttpExchange::requestText(char *out, size_t len) const
+{
+    int n = snprintf(out, len, "GET %s HTTP/1.0\r\nHost: %s", path, hostName);
+    if (hostPort != 80)
+        n += snprintf(out + n, len - n, ":%u", hostPort);
+    n += snprintf(out + n, len - n, "\r\nUser-Agent: ESP32HTTPClient\r\nConnection: close\r\n");
+    if (request->compressed)
+        n += snprintf(out + n, len - n, "Accept-Encoding: gzip, deflate\r\n");
+
+    // Conditional request, the server answers 304 without a body when nothing changed
+    const HttpValidators *v = request->validators;
+    if (v && v->etag[0])
+        n += snprintf(out + n, len - n, "If-None-Match: %s\r\n", v->etag);
+    if (v && v->lastModified[0])
+        n += snprintf(out + n, len - n, "If-Modified-Since: %s\r\n", v->lastModified);
+    n += snprintf(out + n, len - n, "\r\n");
+    return (size_t)n < len ? n : len - 1;
+}
+
+void HttpExchange::headerLine()
+{
+    line[lineLen] = '\0';
+    if (request->code == 0) // status line, "HTTP/1.1 200 OK"
+    {
+        const char *space = strchr(line, ' ');
+        request->code = space ? atoi(space + 1) : 0;
+        if (request->code <= 0)
+            request->code = HTTP_ERROR_NO_HTTP_SERVER;
+        if (request->code == HTTP_STATUS_OK && request->validators)
+            memset(request->validators, 0, sizeof(HttpValidators)); // replaced by this response
+    }
+    else if (lineLen == 0)
+    {
+        inBody = true;
+        if (request->code == HTTP_STATUS_NOT_MODIFIED)
+            remaining = 0; // no body, the cached copy is still good
+    }
+    else if (strncasecmp(line, "Content-Length:", 15) == 0)
+        remaining = atol(line + 15);
+    else if (strncasecmp(line, "Content-Encoding:", 17) == 0 && request->compressed)
+    {
+        const char *value = line + 17;
+        while (*value == ' ')
+            value++;
+        bool gzip = strncasecmp(value, "gzip", 4) == 0 || strncasecmp(value, "x-gzip", 6) == 0;
+        if (gzip || strncasecmp(value, "deflate", 7) == 0)
+        {
+            inflating = true;
+            if (!inflater.begin(gzip ? INFLATE_GZIP : INFLATE_DEFLATE, request->sink, request->ctx))
+                request->code = HTTP_ERROR_TOO_LESS_RAM;
+        }
+    }
+    else if (request->code == HTTP_STATUS_OK && request->validators)
+    {
+        HttpValidators &v = *request->validators;
+        if (strncasecmp(line, "ETag:", 5) == 0)
+            copyHeaderValue(line + 5, v.etag, sizeof(v.etag));
+        else if (strncasecmp(line, "Last-Modified:", 14) == 0)
+            copyHeaderValue(line + 14, v.lastModified, sizeof(v.lastModified));
+    }
+    lineLen = 0;
+}
+
+bool HttpExchange::receive(const uint8_t *data, size_t len)
+{
+    // Headers, one line at a time
+    while (len > 0 && !inBody)
+    {
+        char c = *data++;
+        len--;
+        if (c == '\n')
+            headerLine();
+        else if (c != '\r' && lineLen < sizeof(line) - 1)
+            line[lineLen++] = c;
+    }
+    if (!inBody)
+        return true;
+
+    // Body, straight to the sink
+    if (remaining >= 0 && (long)len > remaining)
+        len = remaining;
+    request->bodyBytes += len;
+    bool more;
+    if (len == 0)
+        more = true;
+    else if (inflating)
+        more = request->code != HTTP_ERROR_TOO_LESS_RAM && inflater.feed(data, len);
+    else
+        more = request->sink(data, len, request->ctx);
+    if (remaining > 0)
+        remaining -= len;
+    if (!more)
+        stopped = !(inflating && inflater.failed());
+    return more && remaining != 0;
+}
+
+void HttpExchange::finish(bool timedOut)
+{
+    if (request->code == 0)
+        request->code = timedOut ? HTTP_ERROR_READ_TIMEOUT : HTTP_ERROR_CONNECTION_LOST;
+
+    // A body cut short or damaged is not a response unless the sink itself stopped it,
+    // a compressed one has to end with a checked trailer
+    const bool incomplete = inflating ? !inflater.done() : remaining > 0;
+    if (request->code == HTTP_STATUS_OK && !stopped && incomplete)
+    {
+        if (inflating && (inflater.failed() || remaining == 0))
+            request->code = HTTP_ERROR_ENCODING; // all of it arrived and it does not decode
+        else
+            request->code = timedOut ? HTTP_ERROR_READ_TIMEOUT : HTTP_ERROR_CONNECTION_LOST;
+    }
+}
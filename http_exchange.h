@@ -0,0 +1,67 @@
+#ifndef HTTP_EXCHANGE_H
+#define HTTP_EXCHANGE_H
+
+// One HTTP/1.0 GET of an HttpRequest without the socket: builds the request
+// text (conditional and compressed requests included) and parses the
+// response as it arrives, headers line by line and the body straight to the
+// sink. hal.cpp drives it from the AsyncTCP callbacks, tools/http_check.cpp
+// from plain sockets against a stand-in server on the PC.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "http_request.h"
+#include "inflate_stream.h"
+
+class HttpExchange
+{
+public:
+    /**
+     * @brief Starts the exchange of one request, code and bodyBytes are reset
+     * @param request Request to run, has to outlive the exchange
+     * @return bool false when the URL is not http://host[:port]/path
+     */
+    bool begin(HttpRequest &request);
+    const char *host() const { return hostName; }
+    uint16_t port() const { return hostPort; }
+
+    /**
+     * @brief Writes the GET with its Host, Accept-Encoding and conditional headers
+     * @param out Buffer for the request text, NUL terminated
+     * @param len Size of out
+     * @return size_t Length of the text
+     */
+    size_t requestText(char *out, size_t len) const;
+
+    /**
+     * @brief Parses the next bytes of the response
+     * @param data Bytes as read from the socket
+     * @param len Number of bytes
+     * @return bool false once the body is complete or the sink stopped, close the connection then
+     */
+    bool receive(const uint8_t *data, size_t len);
+
+    /**
+     * @brief Settles the code after the connection ended
+     * @param timedOut The connection was dropped for taking too long
+     * @note A missing status becomes a timeout or a lost connection, a 200 whose
+     *       body was cut short or does not decode becomes an error code
+     */
+    void finish(bool timedOut);
+
+private:
+    void headerLine();
+
+    HttpRequest *request;
+    char hostName[64];
+    uint16_t hostPort;
+    const char *path;
+    char line[96]; // current header line, longer ones are truncated
+    uint8_t lineLen;
+    bool inBody;
+    long remaining; // body bytes still expected, -1 without Content-Length
+    InflateStream inflater;
+    bool inflating; // body is gzip or deflate, fed through inflater
+    bool stopped;   // the sink ended the body early
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef HTTP_REQUEST_H
+#define HTTP_REQUEST_H
+
+// Requests and body sinks of halHttpGetAll(), apart from hal.h so the body
+// decoders (inflate_stream.h) and the host tools do not need the board.
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Receives one chunk of a response body
+ * @param data Bytes as read from the socket
+ * @param len Number of bytes
+ * @param ctx Pointer given with the request
+ * @return bool false to stop reading
+ */
+typedef bool (*HttpBodySink)(const uint8_t *data, size_t len, void *ctx);
+
+/**
+ * @brief Cache validators of one endpoint for conditional requests
+ */
+struct HttpValidators
+{
+    char etag[64];         // ETag of the last 200 response, empty when none
+    char lastModified[32]; // Last-Modified of the last 200 response, empty when none
+};
+
+/**
+ * @brief One GET for halHttpGetAll()
+ */
+struct HttpRequest
+{
+    const char *url;            // http://host[:port]/path
+    HttpBodySink sink;          // body chunks, called from the AsyncTCP task
+    void *ctx;                  // passed through to sink
+    HttpValidators *validators; // sent as If-None-Match/If-Modified-Since and replaced on a 200, may be null
+    bool compressed;            // accept gzip/deflate, the sink still gets plain bytes
+    int code;                   // out: HTTP status code, or a negative HTTP_ERROR_* code
+    uint32_t latencyUs;         // out: connect to last body byte
+    uint32_t dnsUs;             // out: host lookup, 0 when the address was cached
+    uint32_t dnsSavedUs;        // out: on a cache hit, what the last real lookup of the host took
+    uint32_t bodyBytes;         // out: body bytes received (compressed size), 0 on a 304
+};
+
+#define HTTP_MAX_REQUESTS 4
+
+// Status codes the fetch code acts on
+#define HTTP_STATUS_OK 200
+#define HTTP_STATUS_NOT_MODIFIED 304
+
+// Failures left in HttpRequest::code, the values of the HTTPC_ERROR_* codes
+// of HTTPClient so they read the same in the logs
+#define HTTP_ERROR_CONNECTION_REFUSED -1
+#define HTTP_ERROR_CONNECTION_LOST -5
+#define HTTP_ERROR_NO_HTTP_SERVER -7
+#define HTTP_ERROR_TOO_LESS_RAM -8
+#define HTTP_ERROR_ENCODING -9
+#define HTTP_ERROR_READ_TIMEOUT -11
+
+#endif
@@ -0,0 +1,294 @@
+#ifndef ICON_SPRITES_H
+#define ICON_SPRITES_H
+
+// Generated by tools/icon_sprites.cpp from the icon functions in icons.h, do
+// not edit. Each weather icon of weatherPrint() as black and red 1bpp bitmaps,
+// except the ones with nullptr bitmaps, those are drawn from primitives.
+
+#include "icons.h"
+
+#define ICON_SPRITE_SMALL_R 15 // r the small sprites were drawn with
+#define ICON_SPRITE_LARGE_S 60 // s the large sprites were drawn with
+
+enum IconSpriteId : uint8_t
+{
+    ICON_SPRITE_SUN,
+    ICON_SPRITE_MOON,
+    ICON_SPRITE_CLOUD,
+    ICON_SPRITE_CLOUDY_DAY,
+    ICON_SPRITE_CLOUDY_NIGHT,
+    ICON_SPRITE_CLOUDY,
+    ICON_SPRITE_SLEET,
+    ICON_SPRITE_RAIN,
+    ICON_SPRITE_THUNDERSTORM,
+    ICON_SPRITE_SNOW,
+    ICON_SPRITE_FOG,
+    ICON_SPRITE_COUNT
+};
+
+const uint8_t spriteMoonBlack[] PROGMEM = {
+    0x00,0x0f,0x80,0x00,0x00,0x7f,0x80,0x00,0x01,0xf1,0x80,0x00,0x03,0x81,0x80,0x00,
+    0x07,0x00,0xc0,0x00,0x0e,0x00,0xc0,0x00,0x1c,0x00,0xc0,0x00,0x38,0x00,0x60,0x00,
+    0x30,0x00,0x70,0x00,0x60,0x00,0x38,0x00,0x60,0x00,0x1c,0x00,0x60,0x00,0x0e,0x00,
+    0xc0,0x00,0x07,0x00,0xc0,0x00,0x03,0xe0,0xc0,0x00,0x00,0xfe,0xc0,0x00,0x00,0x1e,
+    0xc0,0x00,0x00,0x06,0xc0,0x00,0x00,0x06,0xc0,0x00,0x00,0x06,0x60,0x00,0x00,0x0c,
+    0x60,0x00,0x00,0x0c,0x60,0x00,0x00,0x0c,0x30,0x00,0x00,0x18,0x38,0x00,0x00,0x38,
+    0x1c,0x00,0x00,0x70,0x0e,0x00,0x00,0xe0,0x07,0x00,0x01,0xc0,0x03,0x80,0x03,0x80,
+    0x01,0xf0,0x1f,0x00,0x00,0x7f,0xfc,0x00,0x00,0x0f,0xe0,0x00
+};
+
+const uint8_t spriteMoonRed[] PROGMEM = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x7e,0x00,0x00,
+    0x00,0xff,0x00,0x00,0x01,0xff,0x00,0x00,0x03,0xff,0x00,0x00,0x07,0xff,0x80,0x00,
+    0x0f,0xff,0x80,0x00,0x1f,0xff,0xc0,0x00,0x1f,0xff,0xe0,0x00,0x1f,0xff,0xf0,0x00,
+    0x3f,0xff,0xf8,0x00,0x3f,0xff,0xfc,0x00,0x3f,0xff,0xff,0x00,0x3f,0xff,0xff,0xe0,
+    0x3f,0xff,0xff,0xf8,0x3f,0xff,0xff,0xf8,0x3f,0xff,0xff,0xf8,0x1f,0xff,0xff,0xf0,
+    0x1f,0xff,0xff,0xf0,0x1f,0xff,0xff,0xf0,0x0f,0xff,0xff,0xe0,0x07,0xff,0xff,0xc0,
+    0x03,0xff,0xff,0x80,0x01,0xff,0xff,0x00,0x00,0xff,0xfe,0x00,0x00,0x7f,0xfc,0x00,
+    0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+const uint8_t spriteCloudBlack[] PROGMEM = {
+    0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x00,0x00,0x00,0x00,0x00,
+    0x7f,0xff,0xc0,0x00,0x00,0x00,0x00,0xfc,0x07,0xe0,0x00,0x00,0x00,0x01,0xf0,0x01,
+    0xf0,0x00,0x00,0x00,0x03,0xc0,0x00,0x78,0x00,0x00,0x00,0x07,0x80,0x00,0x3c,0x00,
+    0x00,0x00,0x0f,0x00,0x00,0x1e,0x00,0x00,0x00,0x0e,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x0f,0x00,0x00,0x00,0x1c,0x00,0x00,0x07,0x00,0x00,0x00,0x1c,0x00,
+    0x00,0x07,0x00,0x00,0x00,0x38,0x00,0x00,0x03,0x80,0x00,0x00,0x38,0x00,0x00,0x03,
+    0x80,0x00,0x00,0x38,0x00,0x00,0x03,0x80,0x00,0x00,0x78,0x00,0x00,0x03,0xf8,0x00,
+    0x01,0xf8,0x00,0x00,0x03,0xfe,0x00,0x07,0x80,0x00,0x00,0x00,0x07,0x80,0x0e,0x00,
+    0x00,0x00,0x00,0x01,0xc0,0x1c,0x00,0x00,0x00,0x00,0x00,0xe0,0x38,0x00,0x00,0x00,
+    0x00,0x00,0x70,0x30,0x00,0x00,0x00,0x00,0x00,0x30,0x60,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x60,0x00,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xc0,
+    0x00,0x00,0x00,0x00,0x00,0x0c,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xc0,0x00,0x00,
+    0x00,0x00,0x00,0x0c,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xc0,0x00,0x00,0x00,0x00,
+    0x00,0x0c,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0x60,0x00,0x00,0x00,0x00,0x00,0x18,
+    0x60,0x00,0x00,0x00,0x00,0x00,0x18,0x30,0x00,0x00,0x00,0x00,0x00,0x30,0x38,0x00,
+    0x00,0x00,0x00,0x00,0x70,0x1c,0x00,0x00,0x00,0x00,0x00,0xe0,0x0e,0x00,0x00,0x00,
+    0x00,0x01,0xc0,0x07,0x80,0xff,0xff,0xfc,0x07,0x80,0x01,0xff,0xff,0xff,0xff,0xfe,
+    0x00,0x00,0x7f,0xff,0xff,0xff,0xf8,0x00
+};
+
+const uint8_t spriteCloudyDayBlack[] PROGMEM = {
+    0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x04,0x00,0x20,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x04,
+    0x00,0x00,0x00,0x01,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x81,0xfc,0x10,0x00,0x00,
+    0x00,0x3f,0xc7,0x07,0x00,0x00,0x00,0x00,0xff,0xec,0x01,0x80,0x00,0x00,0x03,0xff,
+    0xf8,0x00,0x40,0x00,0x00,0x07,0xe0,0xfc,0x00,0x20,0x00,0x00,0x0f,0x80,0x3e,0x00,
+    0x30,0x00,0x00,0x1e,0x00,0x0f,0x00,0x10,0x00,0x00,0x1c,0x00,0x07,0x00,0x18,0x00,
+    0x00,0x3c,0x00,0x07,0x80,0x08,0x00,0x00,0x38,0x00,0x03,0x80,0x08,0x00,0x00,0x78,
+    0x00,0x03,0xc0,0x09,0xf0,0x00,0x70,0x00,0x01,0xc0,0x08,0x00,0x01,0xf0,0x00,0x01,
+    0xfc,0x08,0x00,0x07,0xf0,0x00,0x01,0xff,0x18,0x00,0x0f,0x00,0x00,0x01,0x07,0x90,
+    0x00,0x1c,0x00,0x00,0x00,0x01,0xf0,0x00,0x38,0x00,0x00,0x00,0x00,0xe0,0x00,0x70,
+    0x00,0x00,0x00,0x00,0x70,0x00,0x60,0x00,0x00,0x00,0x00,0x30,0x00,0xe0,0x00,0x00,
+    0x00,0x00,0x38,0x00,0xc0,0x00,0x00,0x00,0x00,0x18,0x00,0xc0,0x00,0x00,0x00,0x00,
+    0x1c,0x00,0xc0,0x00,0x00,0x00,0x00,0x1a,0x00,0xc0,0x00,0x00,0x00,0x00,0x18,0x00,
+    0xc0,0x00,0x00,0x00,0x00,0x18,0x00,0xe0,0x00,0x00,0x00,0x00,0x38,0x00,0x60,0x00,
+    0x00,0x00,0x00,0x30,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,
+    0x00,0xe0,0x00,0x1c,0x00,0x00,0x00,0x01,0xc0,0x00,0x0f,0x07,0xff,0xff,0x07,0x80,
+    0x00,0x07,0xff,0xff,0xff,0xff,0x00,0x00,0x01,0xfc,0x00,0x01,0xfc,0x00,0x00
+};
+
+const uint8_t spriteCloudyDayRed[] PROGMEM = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x00,0x00,
+    0x07,0xff,0x80,0x00,0x00,0x00,0x00,0x03,0xff,0xc0,0x00,0x00,0x00,0x00,0x01,0xff,
+    0xc0,0x00,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,
+    0x00,0x00,0x00,0x00,0x7f,0xf0,0x00,0x00,0x00,0x00,0x00,0x7f,0xf0,0x00,0x00,0x00,
+    0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,
+    0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x60,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+const uint8_t spriteCloudyNightBlack[] PROGMEM = {
+    0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x07,0x20,0x00,0x00,0x00,0x00,0x0c,
+    0x20,0x00,0x00,0x00,0x00,0x10,0x30,0x00,0x00,0x00,0x00,0x20,0x10,0x00,0x00,0x00,
+    0x3f,0xe0,0x18,0x00,0x00,0x00,0xff,0xe0,0x08,0x00,0x00,0x03,0xff,0xf8,0x04,0x00,
+    0x00,0x07,0xe0,0xfc,0x03,0x00,0x00,0x0f,0x80,0x3e,0x01,0xc0,0x00,0x1e,0x00,0x0f,
+    0x00,0x78,0x00,0x1c,0x00,0x07,0x00,0x08,0x00,0x3c,0x00,0x07,0x80,0x08,0x00,0x38,
+    0x00,0x03,0x80,0x18,0x00,0x78,0x00,0x03,0xc0,0x10,0x00,0x70,0x00,0x01,0xc0,0x30,
+    0x01,0xf0,0x00,0x01,0xfc,0x20,0x07,0xf0,0x00,0x01,0xff,0x40,0x0f,0x00,0x00,0x01,
+    0x07,0x80,0x1c,0x00,0x00,0x00,0x01,0xc0,0x38,0x00,0x00,0x00,0x00,0xe0,0x70,0x00,
+    0x00,0x00,0x00,0x70,0x60,0x00,0x00,0x00,0x00,0x30,0xe0,0x00,0x00,0x00,0x00,0x38,
+    0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,
+    0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xe0,0x00,
+    0x00,0x00,0x00,0x38,0x60,0x00,0x00,0x00,0x00,0x30,0x70,0x00,0x00,0x00,0x00,0x70,
+    0x38,0x00,0x00,0x00,0x00,0xe0,0x1c,0x00,0x00,0x00,0x01,0xc0,0x0f,0x07,0xff,0xff,
+    0x07,0x80,0x07,0xff,0xff,0xff,0xff,0x00,0x01,0xfc,0x00,0x01,0xfc,0x00
+};
+
+const uint8_t spriteCloudyNightRed[] PROGMEM = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x03,
+    0xc0,0x00,0x00,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,
+    0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,
+    0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,
+    0xff,0x80,0x00,0x00,0x00,0x00,0xff,0xf0,0x00,0x00,0x00,0x00,0x7f,0xf0,0x00,0x00,
+    0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,0x3f,0xc0,
+    0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+const uint8_t spriteCloudyBlack[] PROGMEM = {
+    0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,
+    0x00,0x00,0x38,0xe0,0x00,0x00,0x00,0x00,0x00,0x60,0x30,0x00,0x00,0x00,0x00,0x00,
+    0xe0,0x38,0x00,0x00,0x00,0x00,0x03,0xc0,0x1e,0x00,0x00,0x00,0x3f,0x86,0x00,0x03,
+    0x00,0x00,0x00,0xff,0xe8,0x00,0x00,0x80,0x00,0x03,0xff,0xf8,0x00,0x00,0xc0,0x00,
+    0x07,0xe0,0xfc,0x00,0x00,0x40,0x00,0x0f,0x80,0x3e,0x00,0x00,0x40,0x00,0x1e,0x00,
+    0x0f,0x00,0x00,0x40,0x00,0x1c,0x00,0x07,0x00,0x00,0xc0,0x00,0x3c,0x00,0x07,0x80,
+    0x00,0x80,0x00,0x38,0x00,0x03,0xbf,0xe3,0x00,0x00,0x78,0x00,0x03,0xe0,0x3e,0x00,
+    0x00,0x70,0x00,0x01,0xc0,0x00,0x00,0x01,0xf0,0x00,0x01,0xfc,0x00,0x00,0x07,0xf0,
+    0x00,0x01,0xff,0x00,0x00,0x0f,0x00,0x00,0x01,0x07,0x80,0x00,0x1c,0x00,0x00,0x00,
+    0x01,0xc0,0x00,0x38,0x00,0x00,0x00,0x00,0xe0,0x00,0x70,0x00,0x00,0x00,0x00,0x70,
+    0x00,0x60,0x00,0x00,0x00,0x00,0x30,0x00,0xe0,0x00,0x00,0x00,0x00,0x38,0x00,0xc0,
+    0x00,0x00,0x00,0x00,0x18,0x00,0xc0,0x00,0x00,0x00,0x00,0x18,0x00,0xc0,0x00,0x00,
+    0x00,0x00,0x18,0x00,0xc0,0x00,0x00,0x00,0x00,0x18,0x00,0xc0,0x00,0x00,0x00,0x00,
+    0x18,0x00,0xe0,0x00,0x00,0x00,0x00,0x38,0x00,0x60,0x00,0x00,0x00,0x00,0x30,0x00,
+    0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,0x00,0xe0,0x00,0x1c,0x00,
+    0x00,0x00,0x01,0xc0,0x00,0x0f,0x07,0xff,0xff,0x07,0x80,0x00,0x07,0xff,0xff,0xff,
+    0xff,0x00,0x00,0x01,0xfc,0x00,0x01,0xfc,0x00,0x00
+};
+
+const uint8_t spriteSleetBlack[] PROGMEM = {
+    0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,0x00,0x00,0x03,0xff,0xf8,
+    0x00,0x00,0x00,0x07,0xe0,0xfc,0x00,0x00,0x00,0x0f,0x80,0x3e,0x00,0x00,0x00,0x1e,
+    0x00,0x0f,0x00,0x00,0x00,0x1c,0x00,0x07,0x00,0x00,0x00,0x3c,0x00,0x07,0x80,0x00,
+    0x00,0x38,0x00,0x03,0x80,0x00,0x00,0x78,0x00,0x03,0xc0,0x00,0x00,0x70,0x00,0x01,
+    0xc0,0x00,0x01,0xf0,0x00,0x01,0xfc,0x00,0x07,0xf0,0x00,0x01,0xff,0x00,0x0f,0x00,
+    0x00,0x01,0x07,0x80,0x1c,0x00,0x00,0x00,0x01,0xc0,0x38,0x00,0x00,0x00,0x00,0xe0,
+    0x70,0x00,0x00,0x00,0x00,0x70,0x60,0x00,0x00,0x00,0x00,0x30,0xe0,0x00,0x00,0x00,
+    0x00,0x38,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,
+    0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,
+    0xe0,0x00,0x00,0x00,0x00,0x38,0x60,0x00,0x00,0x00,0x00,0x30,0x70,0x00,0x20,0x82,
+    0x00,0x70,0x38,0x00,0x71,0xc7,0x00,0xe0,0x1c,0x00,0x23,0x82,0x01,0xc0,0x0f,0x00,
+    0x03,0x80,0x07,0x80,0x07,0xc0,0x87,0x08,0x3f,0x00,0x01,0xc1,0xc7,0x1c,0x3c,0x00,
+    0x00,0x03,0x82,0x38,0x00,0x00,0x00,0x03,0x80,0x38,0x00,0x00,0x00,0x01,0x08,0x10,
+    0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00
+};
+
+const uint8_t spriteRainBlack[] PROGMEM = {
+    0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,0x00,0x00,0x03,0xff,0xf8,
+    0x00,0x00,0x00,0x07,0xe0,0xfc,0x00,0x00,0x00,0x0f,0x80,0x3e,0x00,0x00,0x00,0x1e,
+    0x00,0x0f,0x00,0x00,0x00,0x1c,0x00,0x07,0x00,0x00,0x00,0x3c,0x00,0x07,0x80,0x00,
+    0x00,0x38,0x00,0x03,0x80,0x00,0x00,0x78,0x00,0x03,0xc0,0x00,0x00,0x70,0x00,0x01,
+    0xc0,0x00,0x01,0xf0,0x00,0x01,0xfc,0x00,0x07,0xf0,0x00,0x01,0xff,0x00,0x0f,0x00,
+    0x00,0x01,0x07,0x80,0x1c,0x00,0x00,0x00,0x01,0xc0,0x38,0x00,0x00,0x00,0x00,0xe0,
+    0x70,0x00,0x00,0x00,0x00,0x70,0x60,0x00,0x00,0x00,0x00,0x30,0xe0,0x00,0x00,0x00,
+    0x00,0x38,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,
+    0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,
+    0xe0,0x00,0x00,0x00,0x00,0x38,0x60,0x00,0x00,0x00,0x00,0x30,0x70,0x00,0x20,0x82,
+    0x00,0x70,0x38,0x00,0x71,0xc7,0x00,0xe0,0x1c,0x00,0xe3,0x8e,0x01,0xc0,0x0f,0x00,
+    0xe3,0x8e,0x07,0x80,0x07,0xc1,0xc7,0x1c,0x3f,0x00,0x01,0xc1,0xc7,0x1c,0x3c,0x00,
+    0x00,0x03,0x8e,0x38,0x00,0x00,0x00,0x03,0x8e,0x38,0x00,0x00,0x00,0x01,0x1c,0x10,
+    0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00
+};
+
+const uint8_t spriteThunderstormBlack[] PROGMEM = {
+    0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,0x00,0x00,0x03,0xff,0xf8,
+    0x00,0x00,0x00,0x07,0xe0,0xfc,0x00,0x00,0x00,0x0f,0x80,0x3e,0x00,0x00,0x00,0x1e,
+    0x00,0x0f,0x00,0x00,0x00,0x1c,0x00,0x07,0x00,0x00,0x00,0x3c,0x00,0x07,0x80,0x00,
+    0x00,0x38,0x00,0x03,0x80,0x00,0x00,0x78,0x00,0x03,0xc0,0x00,0x00,0x70,0x00,0x01,
+    0xc0,0x00,0x01,0xf0,0x00,0x01,0xfc,0x00,0x07,0xf0,0x00,0x01,0xff,0x00,0x0f,0x00,
+    0x00,0x01,0x07,0x80,0x1c,0x00,0x00,0x00,0x01,0xc0,0x38,0x00,0x00,0x00,0x00,0xe0,
+    0x70,0x00,0x00,0x00,0x00,0x70,0x60,0x00,0x00,0x00,0x00,0x30,0xe0,0x00,0x00,0x00,
+    0x00,0x38,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,
+    0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,
+    0xe0,0x00,0x00,0x00,0x00,0x38,0x60,0x00,0x00,0x00,0x00,0x30,0x70,0x00,0x00,0x82,
+    0x00,0x70,0x38,0x00,0x01,0xc7,0x00,0xe0,0x1c,0x00,0x03,0x8e,0x01,0xc0,0x0f,0x00,
+    0x03,0x8e,0x07,0x80,0x07,0xc0,0x07,0x1c,0x3f,0x00,0x01,0xc0,0x07,0x1c,0x3c,0x00,
+    0x00,0x00,0x0e,0x38,0x00,0x00,0x00,0x00,0x0e,0x38,0x00,0x00,0x00,0x00,0x1c,0x10,
+    0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+const uint8_t spriteThunderstormRed[] PROGMEM = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x07,
+    0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,
+    0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x0b,0x80,0x00,0x00,0x00,0x00,0x03,0x80,0x00,
+    0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00
+};
+
+const uint8_t spriteSnowBlack[] PROGMEM = {
+    0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,0x00,0x00,0x03,0xff,0xf8,
+    0x00,0x00,0x00,0x07,0xe0,0xfc,0x00,0x00,0x00,0x0f,0x80,0x3e,0x00,0x00,0x00,0x1e,
+    0x00,0x0f,0x00,0x00,0x00,0x1c,0x00,0x07,0x00,0x00,0x00,0x3c,0x00,0x07,0x80,0x00,
+    0x00,0x38,0x00,0x03,0x80,0x00,0x00,0x78,0x00,0x03,0xc0,0x00,0x00,0x70,0x00,0x01,
+    0xc0,0x00,0x01,0xf0,0x00,0x01,0xfc,0x00,0x07,0xf0,0x00,0x01,0xff,0x00,0x0f,0x00,
+    0x00,0x01,0x07,0x80,0x1c,0x00,0x00,0x00,0x01,0xc0,0x38,0x00,0x00,0x00,0x00,0xe0,
+    0x70,0x00,0x00,0x00,0x00,0x70,0x60,0x00,0x00,0x00,0x00,0x30,0xe0,0x00,0x00,0x00,
+    0x00,0x38,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,
+    0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,0xc0,0x00,0x00,0x00,0x00,0x18,
+    0xe0,0x00,0x00,0x00,0x00,0x38,0x60,0x00,0x00,0x00,0x00,0x30,0x70,0x00,0x04,0x00,
+    0x00,0x70,0x38,0x00,0x0e,0x00,0x00,0xe0,0x1c,0x00,0x04,0x00,0x01,0xc0,0x0f,0x01,
+    0x00,0x08,0x07,0x80,0x07,0xc3,0x80,0x1c,0x3f,0x00,0x01,0xc1,0x00,0x08,0x3c,0x00,
+    0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+    0x00,0x00,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x03,0x80,0x1c,0x00,0x00,0x00,0x01,
+    0x00,0x08,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x04,0x00,0x00,0x00
+};
+
+const uint8_t spriteFogBlack[] PROGMEM = {
+    0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x7f,0xf0,0x00,0x00,0x00,0x00,0x01,
+    0xff,0xfc,0x00,0x00,0x00,0x00,0x03,0xf0,0x7e,0x00,0x00,0x00,0x00,0x07,0xc0,0x1f,
+    0x00,0x00,0x00,0x00,0x0f,0x00,0x07,0x80,0x00,0x00,0x00,0x0e,0x00,0x03,0x80,0x00,
+    0x00,0x00,0x1e,0x00,0x03,0xc0,0x00,0x00,0x00,0x1c,0x00,0x01,0xc0,0x00,0x00,0x00,
+    0x3c,0x00,0x01,0xe0,0x00,0x00,0x00,0x38,0x00,0x00,0xe0,0x00,0x00,0x00,0xf8,0x00,
+    0x00,0xfe,0x00,0x00,0x03,0xf8,0x00,0x00,0xff,0x80,0x00,0x07,0x80,0x00,0x00,0x83,
+    0xc0,0x00,0x0e,0x00,0x00,0x00,0x00,0xe0,0x00,0x1c,0x00,0x00,0x00,0x00,0x70,0x00,
+    0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x30,0x00,0x00,0x00,0x00,0x18,0x00,0x70,0x00,
+    0x00,0x00,0x00,0x1c,0x00,0x60,0x00,0x00,0x00,0x00,0x0c,0x00,0x60,0x00,0x00,0x00,
+    0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x7f,0xff,0xff,0xff,0xff,0xf0,0x00,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x7f,
+    0xff,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xff,0xff,
+    0xff,0xc0,0x03,0xff,0xff,0xff,0xff,0xff,0xe0,0x01,0xff,0xff,0xff,0xff,0xff,0xc0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xff,0xff,0xff,0xfe,0x00,0x1f,0xff,0xff,0xff,
+    0xff,0xff,0x00,0x0f,0xff,0xff,0xff,0xff,0xfe,0x00
+};
+
+// 3260 bytes of bitmaps
+const IconSprite iconSprites[ICON_SPRITE_COUNT] = {
+    {false, 0, 0, 0, 0, nullptr, nullptr}, // drawn from primitives
+    {false, -15, -15, 31, 31, spriteMoonBlack, spriteMoonRed},
+    {false, -25, -15, 54, 40, spriteCloudBlack, nullptr},
+    {true, 6, 6, 52, 41, spriteCloudyDayBlack, spriteCloudyDayRed},
+    {true, 6, 10, 45, 37, spriteCloudyNightBlack, spriteCloudyNightRed},
+    {true, 7, 9, 50, 38, spriteCloudyBlack, nullptr},
+    {true, 6, 12, 45, 38, spriteSleetBlack, nullptr},
+    {true, 6, 12, 45, 38, spriteRainBlack, nullptr},
+    {true, 6, 12, 45, 40, spriteThunderstormBlack, spriteThunderstormRed},
+    {true, 6, 12, 45, 41, spriteSnowBlack, nullptr},
+    {true, 5, 12, 51, 38, spriteFogBlack, nullptr},
+};
+
+#endif
@@ -1,31 +1,563 @@
 #ifndef ICONS_H
 #define ICONS_H
 
-#include <GxEPD2_3C.h>
+// Weather, moon and battery icons drawn with Adafruit_GFX primitives. Every
+// function is a template over the display class, so each panel gets its own
+// inlined draw path and the colours are resolved at compile time.
 
-// Helper function to invert colors
-uint16_t invertColor(uint16_t color, bool invert);
+#include "hal.h" // for GxEPD_* colours
+
+/**
+ * @brief Colours a panel can show, red falls back to black on BW panels
+ */
+template <typename Display>
+struct PanelColors
+{
+    static constexpr bool hasRed = decltype(Display::epd2)::hasColor;
+    static constexpr uint16_t black = GxEPD_BLACK;
+    static constexpr uint16_t white = GxEPD_WHITE;
+    static constexpr uint16_t red = hasRed ? GxEPD_RED : GxEPD_BLACK;
+};
+
+/**
+ * @brief Ink, paper and accent colour of one frame
+ */
+struct Palette
+{
+    uint16_t fg;     // text and outlines
+    uint16_t bg;     // background
+    uint16_t accent; // red details
+};
+
+/**
+ * @brief Palette of the panel, ghost protection inverts the finished frame instead (EpdFrame::setInverted)
+ */
+template <typename Display>
+constexpr Palette panelPalette()
+{
+    return Palette{PanelColors<Display>::black, PanelColors<Display>::white, PanelColors<Display>::red};
+}
+
+/**
+ * @brief Weather icon rasterized ahead of time, see icon_sprites.h
+ */
+struct IconSprite
+{
+    bool large;           // anchored at the top left of an s x s box, else at the centre of an r circle
+    int8_t dx, dy;        // top left of the bitmaps relative to the anchor
+    uint8_t w, h;
+    const uint8_t *black; // 1bpp PROGMEM, rows padded to whole bytes, MSB first, nullptr: drawn from primitives
+    const uint8_t *red;   // same format, nullptr when the icon has no red
+};
+
+// Crater texture of iconMoonPhase(), one row per entry with the MSB on the
+// left. Drawn at (x - r + 1, y - r + 1) in the foreground colour
+const uint32_t moonSurface[] PROGMEM = {
+    0b00000000000000000000010000000000,
+    0b00000000000000000000000000000000,
+    0b00000000000100000000000100000000,
+    0b00000000000010101000000101000000,
+    0b00000000010000001000000001000000,
+    0b00000000000000101010000000000000,
+    0b00000010000001010110001010010100,
+    0b00000100100100101011101001011010,
+    0b00000001010001101101011011011100,
+    0b00000101001000110101001101001000,
+    0b00000110110100010100100100010110,
+    0b00101010101000010010101110000001,
+    0b00001011010010001000010000000000,
+    0b10001101010101001100000010010010,
+    0b11001010101010100000000000001000,
+    0b00101011010001010000000000000000,
+    0b11010101010100100100000000000000,
+    0b10101010000001010000000000000000,
+    0b01000101010001010000000000000000,
+    0b11101010000010100000000000000000,
+    0b00101010110000001000000000000000,
+    0b01101010001010100101000000000000,
+    0b01011100010010010010000000000000,
+    0b00110111010101101010000000000000,
+    0b00101010101000100101100000000000,
+    0b00010010111111001010000000000000,
+    0b00000110101001010001000000000000,
+    0b00000011010001000100000000000000,
+    0b00000000101001110000000000000000,
+    0b00000000000000100010000000000000,
+    0b00000000000000001000000000000000,
+};
 
 // Icon drawing functions
-void iconCloud(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t r, bool invert = false);
-void iconSun(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t r, bool invert = false);
-void iconMoon(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t r, bool invert = false);
-void iconClearDay(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconClearNight(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconRain(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconSleet(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconSnow(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconWind(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconFog(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconCloudy(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconCloudyDay(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconCloudyNight(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconHail(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconThunderstorm(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconTornado(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t s, bool invert = false);
-void iconMoonPhase(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t r, float phase, bool invert = false);
-void iconSunRise(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, bool direction, bool invert = false);
-void iconBattery(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, byte percent, bool invert = false);
-void fillEllipsis(GxEPD2_3C<GxEPD2_420c_Z21, GxEPD2_420c_Z21::HEIGHT> &display, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t c, bool invert = false);
+template <typename Display>
+void iconCloud(Display &display, uint16_t x, uint16_t y, uint16_t r);
+template <typename Display>
+void iconSun(Display &display, uint16_t x, uint16_t y, uint16_t r);
+template <typename Display>
+void iconMoon(Display &display, uint16_t x, uint16_t y, uint16_t r);
+template <typename Display>
+void iconClearDay(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconClearNight(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconRain(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconSleet(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconSnow(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconWind(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconFog(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconCloudy(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconCloudyDay(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconCloudyNight(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconHail(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconThunderstorm(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconTornado(Display &display, uint16_t x, uint16_t y, uint16_t s);
+template <typename Display>
+void iconMoonPhase(Display &display, uint16_t x, uint16_t y, uint16_t r, float phase);
+template <typename Display>
+void iconSunRise(Display &display, uint16_t x, uint16_t y, bool direction);
+template <typename Display>
+void iconBattery(Display &display, byte percent);
+template <typename Display>
+void fillEllipsis(Display &display, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+template <typename Display>
+void fillMoonRows(Display &display, uint16_t x, uint16_t y, uint16_t r, float lit, uint16_t color);
+template <typename Display>
+void drawMask(Display &display, int16_t x, int16_t y, const uint32_t *rows, uint8_t h, uint16_t color);
+
+// takes battery percent (integer) as input and prints battery icon
+template <typename Display>
+void iconBattery(Display &display, byte percent)
+{
+    const Palette pal = panelPalette<Display>();
+    display.drawRect(8, 4, 12, 7, pal.fg);
+    display.drawRect(6, 5, 2, 5, pal.fg);
+
+    if (percent >= 95) // Full
+        display.fillRect(9, 4, 10, 6, pal.fg);
+    else if (percent >= 85 && percent < 95) // ful-Med
+        display.fillRect(10, 4, 9, 6, pal.fg);
+    else if (percent > 65 && percent < 85) // Med
+        display.fillRect(11, 4, 9, 6, pal.fg);
+    else if (percent > 40 && percent <= 65) // half
+        display.fillRect(13, 4, 7, 6, pal.fg);
+    else if (percent > 20 && percent <= 40) // low
+        display.fillRect(15, 4, 5, 6, pal.fg);
+    else if (percent > 8 && percent <= 20) // critical-low
+        display.fillRect(16, 5, 3, 5, pal.accent);
+    else
+    { // near empty
+        display.drawRect(8, 4, 12, 7, pal.accent);
+        display.drawRect(6, 5, 2, 5, pal.accent);
+    }
+}
+
+template <typename Display>
+void fillEllipsis(Display &display, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    // One span per row pair, the half width only shrinks away from the centre row
+    const int32_t hh = h * h, ww = w * w;
+    int32_t xi = w;
+    for (int32_t yi = 0; yi <= h; yi++)
+    {
+        while (xi * xi * hh + yi * yi * ww > hh * ww)
+            xi--;
+        display.drawFastHLine(x - xi, y + yi, 2 * xi + 1, color);
+        if (yi)
+            display.drawFastHLine(x - xi, y - yi, 2 * xi + 1, color);
+    }
+}
+
+// Set bits of a 32 pixel wide 1bpp PROGMEM mask, MSB on the left, one span per run
+template <typename Display>
+void drawMask(Display &display, int16_t x, int16_t y, const uint32_t *rows, uint8_t h, uint16_t color)
+{
+    for (uint8_t j = 0; j < h; j++)
+    {
+        uint32_t bits = pgm_read_dword(&rows[j]);
+        int16_t col = 0;
+        while (bits)
+        {
+            const uint8_t gap = __builtin_clz(bits);
+            bits <<= gap;
+            col += gap;
+            const uint8_t run = ~bits ? __builtin_clz(~bits) : 32 - col;
+            display.drawFastHLine(x + col, y + j, run, color);
+            bits = run < 32 ? bits << run : 0;
+            col += run;
+        }
+    }
+}
+
+// Rows of the moon from the left limb to the terminator, one span per row.
+// Same pixels as drawLine(x - cx, y +- i, x - cx + cx * 2 * lit, y +- i) with
+// cx = sqrt(r * r - i * i), without the per row sqrt: the limb is the integer
+// square root of n = r * r - i * i and the terminator sits at x + k * cx with
+// k = 2 * lit - 1, i.e. t = floor(|k| * cx) is the largest t with t * t <= k * k * n.
+// Both only shrink away from the centre row. The rare rows whose terminator is
+// too close to a pixel edge for the Q14 k * k to call use the float expression.
+template <typename Display>
+void fillMoonRows(Display &display, uint16_t x, uint16_t y, uint16_t r, float lit, uint16_t color)
+{
+    const float k = 2 * lit - 1;
+    const uint32_t kk = k * k * 16384 + 0.5f;
+    uint32_t s = r; // floor(sqrt(n))
+    uint32_t t = r; // floor(|k| * sqrt(n))
+    for (int i = 0; i < r + 1; i++)
+    {
+        const uint32_t n = r * r - i * i;
+        while (s * s > n)
+            s--;
+        const uint32_t kn = kk * n;
+        while ((t * t << 14) > kn)
+            t--;
+        const uint32_t slack = n + 8 * t + 16; // rounding of kk and of the float expression
+        const int16_t x0 = x - s - (s * s != n);
+        int16_t x1;
+        if (kn - (t * t << 14) < slack || ((t + 1) * (t + 1) << 14) - kn <= slack)
+        {
+            float cx = sqrt(n);
+            x1 = x - cx + cx * 2 * lit;
+        }
+        else
+            x1 = k < 0 ? x - t - 1 : x + t;
+        display.drawFastHLine(x0, y + i, x1 - x0 + 1, color);
+        display.drawFastHLine(x0, y - i, x1 - x0 + 1, color);
+    }
+}
+
+// Separate the icons in future update to separate file
+template <typename Display>
+void iconCloud(Display &display, uint16_t x, uint16_t y, uint16_t r)
+{
+    const Palette pal = panelPalette<Display>();
+    // top circle
+    display.fillCircle(x, y, r, pal.fg);
+    // left circle
+    display.fillCircle(x - r * 0.85, y + r * 0.8, r * 0.85, pal.fg);
+    // right circle
+    display.fillCircle(x + r * 1.1, y + r * 0.8, r * 0.85, pal.fg);
+    // rectangle
+    display.fillRect(x - r * 0.85, y + r * 0.8, (x + r * 1.1) - (x - r * 0.85), r * 0.9, pal.fg);
+
+    // top circle
+    float offset = 0.8;
+    display.fillCircle(x, y, r * offset, pal.bg);
+    // left circle
+    display.fillCircle(x - r * 0.85, y + r * 0.8, r * 0.85 * offset, pal.bg);
+    // right circle
+    display.fillCircle(x + r * 1.1, y + r * 0.8, r * 0.85 * offset, pal.bg);
+    // rectangle
+    display.fillRect(x - r * 0.85, y + r * 0.7, (x + r * 1.1) - (x - r * 0.85), r * offset, pal.bg);
+}
+
+template <typename Display>
+void iconSun(Display &display, uint16_t x, uint16_t y, uint16_t r)
+{
+    const Palette pal = panelPalette<Display>();
+    display.drawLine(x - r * 1.75, y, x + r * 1.75, y, pal.fg);
+    display.drawLine(x, y - r * 1.75, x, y + r * 1.75, pal.fg);
+    display.drawLine(x - r * 1.25, y - r * 1.25, x + r * 1.25, y + r * 1.25, pal.fg);
+    display.drawLine(x - r * 1.25, y + r * 1.25, x + r * 1.25, y - r * 1.25, pal.fg);
+    display.fillCircle(x, y, r * 1.2, pal.bg);
+    display.fillCircle(x, y, r, pal.fg);
+    float offset = 0.9;
+    display.fillCircle(x, y, r * offset, pal.accent);
+}
+
+template <typename Display>
+void iconMoon(Display &display, uint16_t x, uint16_t y, uint16_t r)
+{
+    const Palette pal = panelPalette<Display>();
+    float offset = 0.9;
+    display.fillCircle(x, y, r, pal.fg);
+    display.fillCircle(x, y, r * offset, pal.accent);
+    display.fillCircle(x + r, y - r, r, pal.fg);
+    display.fillCircle(x + r, y - r, r * offset, pal.bg);
+    display.fillRect(x, y - r * 2, r * 2.5, r, pal.bg);
+    display.fillRect(x + r + 1, y - r, r * 1.5, r * 1.5, pal.bg);
+}
+
+template <typename Display>
+void iconClearDay(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    iconSun(display, x + s / 2, y + s / 2, s / 5);
+}
+
+template <typename Display>
+void iconClearNight(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    iconMoon(display, x + s / 2, y + s / 2, s / 5);
+}
+
+template <typename Display>
+void iconRain(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    const Palette pal = panelPalette<Display>();
+    iconCloud(display, x + s / 2.2, y + s / 2.5, s / 5);
+    display.fillRect(x + s * 0.275, y + s * 0.6, s / 2.5, s / 5, pal.bg);
+
+    float offset = 0.8;
+    for (int i = 0; i <= s * 0.1; i++)
+    {
+        display.fillCircle(x + s * 0.4 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+        display.fillCircle(x + s * 0.6 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+    }
+    for (int i = 0; i <= s * 0.16; i++)
+    {
+        display.fillCircle(x + s * 0.5 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+    }
+}
+
+template <typename Display>
+void iconSleet(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    const Palette pal = panelPalette<Display>();
+    iconCloud(display, x + s / 2.2, y + s / 2.5, s / 5);
+    display.fillRect(x + s * 0.275, y + s * 0.6, s / 2.5, s / 5, pal.bg);
+
+    float offset = 0.8;
+    for (int i = 0; i <= s * 0.1; i++)
+    {
+        if (i < 1 || i > s * 0.1 * 0.5)
+        {
+            display.fillCircle(x + s * 0.4 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+            display.fillCircle(x + s * 0.6 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+        }
+    }
+    for (int i = 0; i <= s * 0.16; i++)
+    {
+        if (i < s * 0.16 * 0.5 || i > s * 0.16 * 0.8)
+            display.fillCircle(x + s * 0.5 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+    }
+}
+
+template <typename Display>
+void iconSnow(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    const Palette pal = panelPalette<Display>();
+    iconCloud(display, x + s / 2.2, y + s / 2.5, s / 5);
+    display.fillRect(x + s * 0.275, y + s * 0.6, s / 2.5, s / 5, pal.bg);
+
+    float offset = 0.8;
+    display.fillCircle(x + s / 2.75, y + s * 0.7, s * 0.02, pal.fg);
+    display.fillCircle(x + s / 1.75, y + s * 0.7, s * 0.02, pal.fg);
+
+    display.fillCircle(x + s / 2.75, y + s * 0.8, s * 0.02, pal.fg);
+    display.fillCircle(x + s / 1.75, y + s * 0.8, s * 0.02, pal.fg);
+
+    display.fillCircle(x + s / 2.15, y + s * 0.65, s * 0.02, pal.fg);
+    display.fillCircle(x + s / 2.15, y + s * 0.75, s * 0.02, pal.fg);
+    display.fillCircle(x + s / 2.15, y + s * 0.85, s * 0.02, pal.fg);
+}
+
+template <typename Display>
+void iconWind(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    const Palette pal = panelPalette<Display>();
+    float offset = 0.8;
+    for (int i = 0; i <= s * 0.7; i++)
+    {
+        if (i < s * 0.6)
+            display.fillCircle(x + s * 0.15 + i, y + s * 0.4, s * 0.02, pal.fg);
+        if (i < s * 0.5)
+            display.fillCircle(x + s * 0.1 + i, y + s * 0.5, s * 0.02, pal.fg);
+        if (i < s * 0.2)
+            display.fillCircle(x + s * 0.7 + i, y + s * 0.5, s * 0.02, pal.fg);
+        if (i < s * 0.6)
+            display.fillCircle(x + s * 0.2 + i, y + s * 0.6, s * 0.02, pal.fg);
+    }
+}
+
+template <typename Display>
+void iconFog(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    const Palette pal = panelPalette<Display>();
+    iconCloud(display, x + s / 2.2, y + s / 2.5, s / 5);
+    display.fillRect(x + s * 0.1, y + s * 0.55, s * 0.75, s / 5, pal.bg);
+
+    float offset = 0.8;
+    for (int i = 0; i <= s * 0.7; i++)
+    {
+        display.fillCircle(x + s * 0.1 + i, y + s * 0.6, s * 0.02, pal.fg);
+        display.fillCircle(x + s * 0.2 + i, y + s * 0.7, s * 0.02, pal.fg);
+        display.fillCircle(x + s * 0.15 + i, y + s * 0.8, s * 0.02, pal.fg);
+    }
+}
+
+template <typename Display>
+void iconCloudy(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    iconCloud(display, x + (s / 4) * 3, y + s / 4, s / 10);
+    iconCloud(display, x + s / 2.1, y + s / 2.2, s / 5);
+}
+
+template <typename Display>
+void iconCloudyDay(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    iconSun(display, x + (s / 3) * 2, y + s / 2.5, s / 6);
+    iconCloud(display, x + s / 2.2, y + s / 2.2, s / 5);
+}
+
+template <typename Display>
+void iconCloudyNight(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    iconMoon(display, x + (s / 3) * 2, y + s / 3, s / 6);
+    iconCloud(display, x + s / 2.2, y + s / 2.2, s / 5);
+}
+
+template <typename Display>
+void iconHail(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    const Palette pal = panelPalette<Display>();
+    iconCloud(display, x + s / 2.2, y + s / 2.5, s / 5);
+    display.fillRect(x + s * 0.275, y + s * 0.6, s / 2.5, s / 5, pal.bg);
+
+    float offset = 0.8;
+    for (int i = 0; i <= s * 0.1; i++)
+    {
+        if (i < s * 0.1 * 0.5 || i == s * 0.1)
+        {
+            display.fillCircle(x + s * 0.4 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+            display.fillCircle(x + s * 0.6 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+        }
+    }
+    for (int i = 0; i <= s * 0.16; i++)
+    {
+        if (i < s * 0.16 * 0.7 || i == s * 0.16)
+            display.fillCircle(x + s * 0.5 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+    }
+}
+
+template <typename Display>
+void iconThunderstorm(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    const Palette pal = panelPalette<Display>();
+    iconCloud(display, x + s / 2.2, y + s / 2.5, s / 5);
+    display.fillRect(x + s * 0.275, y + s * 0.6, s / 2.5, s / 5, pal.bg);
+
+    float offset = 0.8;
+    for (int i = 0; i <= s * 0.1; i++)
+    {
+        display.fillCircle(x + s * 0.6 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+    }
+    for (int i = 0; i <= s * 0.16; i++)
+    {
+        display.fillCircle(x + s * 0.5 - i * 0.5, y + s * 0.65 + i, s * 0.02, pal.fg);
+    }
+    display.fillTriangle(x + s * 0.3, y + s * 0.75, x + s * 0.325, y + s * 0.65, x + s * 0.375, y + s * 0.65, pal.accent);
+    display.fillTriangle(x + s * 0.3, y + s * 0.75, x + s * 0.4, y + s * 0.7, x + s * 0.33, y + s * 0.7, pal.accent);
+    display.fillTriangle(x + s * 0.3, y + s * 0.85, x + s * 0.35, y + s * 0.7, x + s * 0.4, y + s * 0.7, pal.accent);
+}
+
+template <typename Display>
+void iconTornado(Display &display, uint16_t x, uint16_t y, uint16_t s)
+{
+    const Palette pal = panelPalette<Display>();
+    // 1
+    fillEllipsis(display, x + s * 0.33, y + s * 0.7, s / 12 * 1.2, s / 18 * 1.2, pal.fg);
+    fillEllipsis(display, x + s * 0.33, y + s * 0.7, s / 12, s / 18, pal.bg);
+    // 2
+    fillEllipsis(display, x + s * 0.32, y + s * 0.65, s / 9 * 1.2, s / 16 * 1.2, pal.fg);
+    fillEllipsis(display, x + s * 0.32, y + s * 0.65, s / 9, s / 16, pal.bg);
+    // 3
+    fillEllipsis(display, x + s * 0.35, y + s * 0.55, s / 7 * 1.2, s / 12 * 1.2, pal.fg);
+    fillEllipsis(display, x + s * 0.35, y + s * 0.55, s / 7, s / 12, pal.bg);
+    // 4
+    fillEllipsis(display, x + s * 0.425, y + s * 0.425, s / 5 * 1.2, s / 8 * 1.2, pal.fg);
+    fillEllipsis(display, x + s * 0.425, y + s * 0.425, s / 5, s / 8, pal.bg);
+    // 5
+    fillEllipsis(display, x + s * 0.5, y + s * 0.3, s / 4 * 1.2, s / 7 * 1.2, pal.fg);
+    fillEllipsis(display, x + s * 0.5, y + s * 0.3, s / 4, s / 7, pal.bg);
+}
+
+// Takes x,y coordinates and radius r and phase. Phase denotes Moons current shape
+template <typename Display>
+void iconMoonPhase(Display &display, uint16_t x, uint16_t y, uint16_t r, float phase)
+{
+    const Palette pal = panelPalette<Display>();
+    display.fillCircle(x, y, r, pal.bg);
+    display.drawCircle(x, y, r, pal.fg);
+    if (phase == 0)
+        display.fillCircle(x, y, r, pal.fg); // New Moon
+    else if (phase > 0 && phase < 0.5)
+    {
+        fillMoonRows(display, x, y, r, 1 - (phase * 2), pal.fg);
+    }
+    else if (phase == 0.5)
+        ; // display.fillCircle(x, y, r, pal.accent);  //Full Moon
+    else
+    {
+        display.fillCircle(x, y, r, pal.fg);
+        fillMoonRows(display, x, y, r, (1 - phase) * 2, pal.bg);
+        display.drawCircle(x, y, r, pal.fg);
+    }
+
+    // Add moon surface on top
+    drawMask(display, x - r + 1, y - r + 1, moonSurface, sizeof(moonSurface) / sizeof(moonSurface[0]), pal.fg);
+}
+
+// direction=true (UP), direction=false (DOWN)
+template <typename Display>
+void iconSunRise(Display &display, uint16_t x, uint16_t y, bool direction)
+{
+    const Palette pal = panelPalette<Display>();
+    uint16_t r = 7;
+
+    // Horizontal
+    display.drawLine(x - r * 2 + 2, y, x + r * 2 - 2, y, pal.fg);
+    // Vertical
+    display.drawLine(x, y - r * 2 + 2, x, y, pal.fg);
+    // Angle Top right
+    display.drawLine(x - r * 2 + 5, y - r * 2 + 5, x, y, pal.fg);
+    // Angle Top left
+    display.drawLine(x, y, x + r * 2 - 5, y - r * 2 + 5, pal.fg);
+    // Remove lines inside
+    display.fillCircle(x, y, r + 1, pal.bg);
+    // Empty inside
+    display.fillCircle(x, y, r - 1, pal.accent);
+    display.drawCircle(x, y, r - 1, pal.fg);
+    // Overwrite the bottom
+    display.fillRect(x - r, y + 4, r * 2, r, pal.bg);
+
+    // Arrow up
+    if (direction == true)
+    {
+        display.fillTriangle(x - r / 2 - 1, y + r - 2, x, y + r - 7, x + r / 2 + 1, y + r - 2, pal.bg);
+        display.drawLine(x - r / 2, y + r - 2, x, y + r - 6, pal.fg);
+        display.drawLine(x, y + r - 6, x + r / 2, y + r - 2, pal.fg);
+    }
+    // Arrow DOWN
+    if (direction == false)
+    {
+        display.drawLine(x - r / 2, y + r - 2, x, y + r + 2, pal.fg);
+        display.drawLine(x, y + r + 2, x + r / 2, y + r - 2, pal.fg);
+    }
+    // Horizon line
+    display.drawLine(x - r, y + r - 2, x - r / 2, y + r - 2, pal.fg);
+    display.drawLine(x + r / 2, y + r - 2, x + r, y + r - 2, pal.fg);
+}
+
+/**
+ * @brief Draws a pre-rasterized icon, same pixels as the icon function it was made from
+ * @param x Anchor, top left for large sprites, centre for small ones
+ * @param y Anchor
+ * @note Only ink is drawn, the background under the icon has to be clear
+ */
+template <typename Display>
+void drawIconSprite(Display &display, int16_t x, int16_t y, const IconSprite &sprite)
+{
+    const Palette pal = panelPalette<Display>();
+    display.drawBitmap(x + sprite.dx, y + sprite.dy, sprite.black, sprite.w, sprite.h, pal.fg);
+    if (sprite.red)
+        display.drawBitmap(x + sprite.dx, y + sprite.dy, sprite.red, sprite.w, sprite.h, pal.accent);
+}
 
 #endif
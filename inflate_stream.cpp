@@ -0,0 +1,209 @@
+#include "inflate_stream.h"
+#include <stdlib.h>
+#include <rom/miniz.h>
+#include "crc32.h"
+
+struct InflateStream::State
+{
+    tinfl_decompressor inflator;
+    uint8_t window[TINFL_LZ_DICT_SIZE]; // also the output buffer, wraps around
+};
+
+// gzip header flags (RFC 1952)
+#define GZIP_FHCRC 0x02
+#define GZIP_FEXTRA 0x04
+#define GZIP_FNAME 0x08
+#define GZIP_FCOMMENT 0x10
+
+// gzip header parsing steps
+enum : uint8_t
+{
+    GZ_FIXED,     // ID1 ID2 CM FLG MTIME(4) XFL OS
+    GZ_EXTRA_LEN, // 2 byte length of the extra field
+    GZ_EXTRA,
+    GZ_NAME,      // zero terminated
+    GZ_COMMENT,   // zero terminated
+    GZ_HCRC,
+    GZ_DATA
+};
+
+/**
+ * @brief Allocates the window and starts a new body
+ * @param encoding Value of the Content-Encoding header
+ * @param sink Receives the decompressed bytes
+ * @param ctx Passed through to sink
+ * @return bool false when there is not enough memory
+ */
+bool InflateStream::begin(InflateEncoding encoding, HttpBodySink sink, void *ctx)
+{
+    end();
+    state = static_cast<State *>(malloc(sizeof(State)));
+    if (!state)
+        return false;
+    tinfl_init(&state->inflator);
+    this->sink = sink;
+    this->ctx = ctx;
+    this->encoding = encoding;
+    header = encoding == INFLATE_GZIP ? GZ_FIXED : GZ_DATA;
+    flags = 0;
+    count = 0;
+    length = 0;
+    windowPos = 0;
+    crc = 0;
+    size = 0;
+    trailer[0] = trailer[1] = 0;
+    trailerLen = 0;
+    inflated = false;
+    finished = false;
+    corrupt = false;
+    return true;
+}
+
+void InflateStream::end()
+{
+    free(state);
+    state = nullptr;
+}
+
+// Moves on to the next gzip header field that is present
+void InflateStream::nextField()
+{
+    count = 0;
+    length = 0;
+    do
+        header++;
+    while (((header == GZ_EXTRA_LEN || header == GZ_EXTRA) && !(flags & GZIP_FEXTRA)) ||
+           (header == GZ_NAME && !(flags & GZIP_FNAME)) ||
+           (header == GZ_COMMENT && !(flags & GZIP_FCOMMENT)) ||
+           (header == GZ_HCRC && !(flags & GZIP_FHCRC)));
+}
+
+// Consumes one gzip header byte, false when it is not a deflate gzip stream
+bool InflateStream::gzipHeader(uint8_t c)
+{
+    static const uint8_t magic[3] = {0x1f, 0x8b, 8}; // ID1, ID2, CM = deflate
+
+    switch (header)
+    {
+    case GZ_FIXED:
+        if (count < 3 && c != magic[count])
+            return false;
+        if (count == 3)
+            flags = c;
+        if (++count == 10)
+            nextField();
+        return true;
+
+    case GZ_EXTRA_LEN: // little endian
+        length |= c << (8 * count);
+        if (++count == 2)
+        {
+            header = GZ_EXTRA;
+            if (length == 0)
+                nextField();
+        }
+        return true;
+
+    case GZ_EXTRA:
+        if (--length == 0)
+            nextField();
+        return true;
+
+    case GZ_NAME:
+    case GZ_COMMENT:
+        if (c == 0)
+            nextField();
+        return true;
+
+    case GZ_HCRC:
+        if (++count == 2)
+            nextField();
+        return true;
+    }
+    return false;
+}
+
+// Consumes one byte of the gzip trailer, false when it does not match the plain text
+bool InflateStream::gzipTrailer(uint8_t c)
+{
+    trailer[trailerLen / 4] |= (uint32_t)c << (8 * (trailerLen % 4)); // little endian
+    if (++trailerLen < 8)
+        return true;
+    finished = trailer[0] == crc && trailer[1] == size;
+    return finished;
+}
+
+bool InflateStream::fail()
+{
+    corrupt = true;
+    return false;
+}
+
+/**
+ * @brief Pushes compressed bytes and hands the decompressed ones to the sink
+ * @return bool false on corrupt input or when the sink asked to stop
+ */
+bool InflateStream::feed(const uint8_t *data, size_t len)
+{
+    if (!state)
+        return false;
+
+    while (len > 0 && header != GZ_DATA)
+    {
+        uint8_t c = *data++;
+        len--;
+        if (!gzipHeader(c))
+            return fail();
+    }
+
+    uint32_t flagsIn = TINFL_FLAG_HAS_MORE_INPUT;
+    if (encoding == INFLATE_DEFLATE)
+        flagsIn |= TINFL_FLAG_PARSE_ZLIB_HEADER; // tinfl checks the Adler-32 then
+
+    while (len > 0 && !inflated)
+    {
+        size_t inBytes = len;
+        size_t outBytes = TINFL_LZ_DICT_SIZE - windowPos;
+        tinfl_status status = tinfl_decompress(&state->inflator, data, &inBytes, state->window,
+                                               state->window + windowPos, &outBytes, flagsIn);
+        data += inBytes;
+        len -= inBytes;
+        if (outBytes > 0)
+        {
+            crc = crc32Update(crc, state->window + windowPos, outBytes);
+            size += outBytes;
+            if (!sink(state->window + windowPos, outBytes, ctx))
+                return false;
+        }
+        windowPos = (windowPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+        if (status < 0)
+            return fail();
+        if (status == TINFL_STATUS_DONE)
+        {
+            inflated = true;
+            finished = encoding == INFLATE_DEFLATE;
+            if (finished)
+                break;
+            // tinfl may have read ahead into the trailer, those bytes are still in its
+            // bit buffer after the padding bits of the last deflate byte
+            uint32_t bits = state->inflator.m_num_bits;
+            uint64_t bitBuf = (uint64_t)state->inflator.m_bit_buf >> (bits & 7);
+            for (bits &= ~7u; bits > 0 && !finished; bits -= 8, bitBuf >>= 8)
+                if (!gzipTrailer(bitBuf & 0xff))
+                    return fail();
+        }
+        else if (inBytes == 0 && outBytes == 0)
+            return fail(); // no progress
+    }
+
+    // gzip trailer, anything after it is ignored
+    while (len > 0 && inflated && !finished)
+    {
+        uint8_t c = *data++;
+        len--;
+        if (!gzipTrailer(c))
+            return fail();
+    }
+    return true;
+}
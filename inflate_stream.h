@@ -0,0 +1,59 @@
+#ifndef INFLATE_STREAM_H
+#define INFLATE_STREAM_H
+
+// Streaming gzip/deflate decoder for compressed HTTP bodies, built on the
+// miniz inflater in the ESP32 ROM. Compressed bytes are pushed in as they
+// arrive and the plain text goes to a body sink in pieces, so only the
+// 32 KB deflate window is held, never the whole decompressed body. The
+// window is allocated by begin() and released by end(). A gzip body only
+// counts as done once its trailer (CRC-32 and length of the plain text)
+// matched, a zlib one once tinfl checked its Adler-32.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "http_request.h"
+
+enum InflateEncoding : uint8_t
+{
+    INFLATE_GZIP,    // Content-Encoding: gzip
+    INFLATE_DEFLATE, // Content-Encoding: deflate (zlib wrapped)
+};
+
+class InflateStream
+{
+public:
+    InflateStream() : state(nullptr) {}
+    ~InflateStream() { end(); }
+
+    bool begin(InflateEncoding encoding, HttpBodySink sink, void *ctx);
+    bool feed(const uint8_t *data, size_t len);
+    void end();
+    bool done() const { return finished; }     // the whole body arrived and checked out
+    bool failed() const { return corrupt; }    // bad header, data or trailer
+
+private:
+    bool gzipHeader(uint8_t c);
+    void nextField();
+    bool gzipTrailer(uint8_t c);
+    bool fail();
+
+    struct State;
+    State *state; // inflater and window, only allocated while a body is decoded
+    HttpBodySink sink;
+    void *ctx;
+    InflateEncoding encoding;
+    uint8_t header;       // gzip header field being parsed
+    uint8_t flags;        // gzip FLG byte
+    uint8_t count;        // bytes seen of the current header field
+    uint16_t length;      // gzip extra field length
+    uint16_t windowPos;   // next write position in the window
+    uint32_t crc;         // CRC-32 of the plain text so far
+    uint32_t size;        // plain text bytes so far, modulo 2^32 like ISIZE
+    uint32_t trailer[2];  // gzip CRC32 and ISIZE as they arrive
+    uint8_t trailerLen;   // trailer bytes seen
+    bool inflated;        // tinfl reached the end of the deflate data
+    bool finished;        // inflated and, for gzip, the trailer matched
+    bool corrupt;         // the stream itself is bad, not the sink
+};
+
+#endif
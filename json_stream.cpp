@@ -0,0 +1,241 @@
+#include "json_stream.h"
+
+void JsonStreamExtractor::begin(JsonValueHandler handler, void *ctx)
+{
+    this->handler = handler;
+    this->ctx = ctx;
+    state = VALUE;
+    escape = false;
+    hexLeft = 0;
+    depth = 0;
+    pathLen = 0;
+    path[0] = '\0';
+    keyLen = 0;
+    tokenLen = 0;
+}
+
+bool JsonStreamExtractor::fail()
+{
+    state = FAILED;
+    return false;
+}
+
+void JsonStreamExtractor::setPathLen(uint8_t len)
+{
+    pathLen = len;
+    path[len < JSON_PATH_LEN ? len : JSON_PATH_LEN - 1] = '\0';
+}
+
+void JsonStreamExtractor::appendPath(const char *segment)
+{
+    while (*segment)
+    {
+        if (pathLen < JSON_PATH_LEN - 1)
+            path[pathLen] = *segment;
+        if (pathLen < 255)
+            pathLen++;
+        segment++;
+    }
+    path[pathLen < JSON_PATH_LEN ? pathLen : JSON_PATH_LEN - 1] = '\0';
+}
+
+// Extends the path with the member key or array index of the value that starts now
+bool JsonStreamExtractor::enterValue()
+{
+    if (depth == 0)
+        return true;
+    Frame &top = stack[depth - 1];
+    if (top.array)
+    {
+        char index[8];
+        snprintf(index, sizeof(index), "[%u]", top.index);
+        appendPath(index);
+    }
+    else
+    {
+        if (pathLen > 0)
+            appendPath(".");
+        appendPath(key);
+    }
+    return true;
+}
+
+// Drops the finished value from the path and moves to the next member or element
+void JsonStreamExtractor::leaveValue()
+{
+    if (depth == 0)
+    {
+        state = DONE;
+        return;
+    }
+    Frame &top = stack[depth - 1];
+    setPathLen(top.pathLen);
+    if (top.array)
+        top.index++;
+    state = NEXT_OR_END;
+}
+
+bool JsonStreamExtractor::feed(const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (!feed((char)data[i]))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Pushes one byte of the document
+ * @return bool false once the input is not valid JSON
+ */
+bool JsonStreamExtractor::feed(char c)
+{
+    switch (state)
+    {
+    case DONE:
+        return isspace((unsigned char)c) ? true : fail();
+
+    case FAILED:
+        return false;
+
+    case STRING:
+    case KEY:
+        if (hexLeft > 0)
+        {
+            hexLeft--;
+            return true;
+        }
+        if (escape)
+        {
+            escape = false;
+            // control characters and \uXXXX are kept as '?', the fields we read are plain ASCII
+            if (c == 'u')
+                hexLeft = 4;
+            if (c == 'n' || c == 't' || c == 'r' || c == 'b' || c == 'f' || c == 'u')
+                c = '?';
+        }
+        else if (c == '\\')
+        {
+            escape = true;
+            return true;
+        }
+        else if (c == '"')
+        {
+            if (state == KEY)
+            {
+                key[keyLen] = '\0';
+                state = COLON;
+                return true;
+            }
+            token[tokenLen] = '\0';
+            if (pathLen < JSON_PATH_LEN)
+                handler(path, token, ctx);
+            leaveValue();
+            return true;
+        }
+        if (state == KEY)
+        {
+            if (keyLen < JSON_KEY_LEN - 1)
+                key[keyLen++] = c;
+        }
+        else if (tokenLen < JSON_TOKEN_LEN - 1)
+            token[tokenLen++] = c;
+        return true;
+
+    case LITERAL:
+        if (isalnum((unsigned char)c) || c == '-' || c == '+' || c == '.')
+        {
+            if (tokenLen < JSON_TOKEN_LEN - 1)
+                token[tokenLen++] = c;
+            return true;
+        }
+        token[tokenLen] = '\0';
+        if (pathLen < JSON_PATH_LEN)
+            handler(path, token, ctx);
+        leaveValue();
+        return feed(c); // the delimiter belongs to the enclosing container
+
+    default:
+        break;
+    }
+
+    if (isspace((unsigned char)c))
+        return true;
+
+    switch (state)
+    {
+    case VALUE:
+        enterValue();
+        if (c == '{' || c == '[')
+        {
+            if (depth == JSON_MAX_DEPTH)
+                return fail();
+            stack[depth].array = c == '[';
+            stack[depth].index = 0;
+            stack[depth].pathLen = pathLen;
+            depth++;
+            state = c == '[' ? VALUE : KEY_OR_END;
+        }
+        else if (c == '"')
+        {
+            tokenLen = 0;
+            state = STRING;
+        }
+        else if (c == '-' || isalnum((unsigned char)c))
+        {
+            token[0] = c;
+            tokenLen = 1;
+            state = LITERAL;
+        }
+        else if (c == ']' && depth > 0 && stack[depth - 1].array && stack[depth - 1].index == 0)
+        {
+            // empty array, undo the [0] added above
+            setPathLen(stack[depth - 1].pathLen);
+            depth--;
+            leaveValue();
+        }
+        else
+            return fail();
+        return true;
+
+    case KEY_OR_END:
+        if (c == '"')
+        {
+            keyLen = 0;
+            state = KEY;
+        }
+        else if (c == '}' && depth > 0)
+        {
+            depth--;
+            leaveValue();
+        }
+        else
+            return fail();
+        return true;
+
+    case COLON:
+        if (c != ':')
+            return fail();
+        state = VALUE;
+        return true;
+
+    case NEXT_OR_END:
+    {
+        Frame &top = stack[depth - 1];
+        if (c == ',')
+            state = top.array ? VALUE : KEY_OR_END;
+        else if (c == (top.array ? ']' : '}'))
+        {
+            depth--;
+            leaveValue();
+        }
+        else
+            return fail();
+        return true;
+    }
+
+    default:
+        return fail();
+    }
+}
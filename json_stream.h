@@ -0,0 +1,80 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+// Streaming JSON field extractor. Bytes are pushed in as they arrive from the
+// network and every scalar value is reported together with its path, e.g.
+// "current.weather[0].icon". Nothing is kept apart from the current path and
+// one token, so memory use does not depend on the payload size.
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+#define JSON_MAX_DEPTH 8   // nesting levels tracked
+#define JSON_PATH_LEN 48   // longest path reported, deeper values are skipped
+#define JSON_TOKEN_LEN 48  // longer strings are truncated
+#define JSON_KEY_LEN 24    // longer keys are truncated
+
+/**
+ * @brief Called for every string, number, true, false or null value
+ * @param path Dotted path with [index] for array elements
+ * @param value Raw text, strings without their quotes
+ * @param ctx Pointer given to begin()
+ */
+typedef void (*JsonValueHandler)(const char *path, const char *value, void *ctx);
+
+class JsonStreamExtractor
+{
+public:
+    void begin(JsonValueHandler handler, void *ctx);
+    bool feed(char c);
+    bool feed(const uint8_t *data, size_t len);
+    bool done() const { return state == DONE; }
+    bool failed() const { return state == FAILED; }
+
+private:
+    enum State : uint8_t
+    {
+        VALUE,       // expecting a value
+        KEY_OR_END,  // after '{' or ',' inside an object
+        KEY,         // inside a key string
+        COLON,       // after a key
+        STRING,      // inside a string value
+        LITERAL,     // inside a number, true, false or null
+        NEXT_OR_END, // after a value
+        DONE,
+        FAILED
+    };
+
+    struct Frame
+    {
+        bool array;
+        uint16_t index;   // current element when array
+        uint8_t pathLen;  // path length of the container itself
+    };
+
+    bool enterValue();
+    void leaveValue();
+    void appendPath(const char *segment);
+    void setPathLen(uint8_t len);
+    bool fail();
+
+    JsonValueHandler handler;
+    void *ctx;
+    State state;
+    bool escape;
+    uint8_t hexLeft; // \uXXXX digits still to skip
+    Frame stack[JSON_MAX_DEPTH];
+    uint8_t depth;
+    char path[JSON_PATH_LEN];
+    uint8_t pathLen; // may exceed the buffer, values are skipped then
+    char key[JSON_KEY_LEN];
+    uint8_t keyLen;
+    char token[JSON_TOKEN_LEN];
+    uint8_t tokenLen;
+};
+
+#endif
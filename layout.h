@@ -0,0 +1,201 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+// Screen layouts as compile-time tables. The render functions take a layout
+// as a template argument, so every position and font below is folded into
+// the draw calls and picking a layout costs nothing at run time. The tables
+// are chosen by the resolution of the panel selected in hal.h, a new panel
+// size or arrangement is a new table instead of a copy of the render code.
+
+#include <Arduino.h>
+#include <U8g2_for_Adafruit_GFX.h>
+#include "dirty_region.h" // LayoutRect, Widget
+#include "hal.h"          // for EpdDisplay
+
+struct LayoutPoint
+{
+    int16_t x, y; // text baseline start or icon origin
+};
+
+struct LayoutText
+{
+    int16_t x, y; // baseline start
+    const uint8_t *font;
+};
+
+/**
+ * @brief Status bar, date, indoor temperature and environment row, see tempPrint()
+ */
+struct IndoorLayout
+{
+    LayoutText battery;       // voltage
+    LayoutPoint percent;      // percentage or the battery critical warning
+    LayoutPoint ghost;        // ghost protection note after the percentage
+    LayoutPoint lastUpdate;   // "Last Update: hh:mm"
+    LayoutText date;          // day and month
+    LayoutPoint weekday;      // below the date, same font
+    LayoutText tempDegree;    // small "o" of the main temperature
+    LayoutText temp;          // main temperature
+    LayoutPoint tempUnit;     // "C"
+    LayoutRect separators[2]; // lines above and below the environment row
+    LayoutText humidity;      // humidity, pressure uses the same font
+    LayoutPoint pressure;
+    LayoutText highLow[2];    // "H:" and "L:" with their values
+    LayoutText highLowDegree; // x relative to highLow, y absolute
+    int16_t highLowUnit;      // "C", x relative to highLow
+};
+
+/**
+ * @brief Outdoor block, dividers and weather icon, see weatherPrint()
+ */
+struct WeatherLayout
+{
+    LayoutText title;       // "OUTDOOR"
+    LayoutText temp;        // outdoor temperature
+    int16_t tempUnit;       // "C", x relative to the value width
+    LayoutText tempDegree;  // x relative to the value width
+    LayoutText feelsLike;   // "Real Feel:" label
+    int16_t feelsValueX;    // value after the label
+    int16_t feelsUnit;      // "C", x relative to the label and value width
+    LayoutText feelsDegree; // x relative to the label and value width
+    LayoutText humidity;    // outdoor humidity, pressure uses the same font
+    LayoutPoint pressure;
+    LayoutText uvi;         // "UVI:" and the value
+    const uint8_t *uviLevelFont;
+    LayoutRect dividers[3]; // between outdoor block, sun row and icon, below the icon
+    LayoutPoint iconSmall;  // centre of single-shape icons
+    uint16_t iconSmallR;
+    LayoutPoint iconLarge;  // top left of composed icons
+    uint16_t iconLargeS;
+    LayoutText main;        // description under the icon
+    int16_t alertY;         // baseline of the centred alert line
+};
+
+/**
+ * @brief Sunrise/sunset row and moon phase, see skyPrint()
+ */
+struct SkyLayout
+{
+    LayoutText sun[2]; // sunrise and sunset times
+    int16_t sunIconX[2];
+    int16_t sunIconDy; // icon centre relative to the text baseline
+    LayoutPoint moon;  // centre
+    uint16_t moonR;
+    LayoutText moonLabel;
+};
+
+struct ScreenLayout
+{
+    LayoutPoint wifiIcon; // wifi status or wifi off icon
+    IndoorLayout indoor;
+    WeatherLayout weather;
+    SkyLayout sky;
+};
+
+/**
+ * @brief Moves the indoor widgets and the sun row down for the layouts without weather
+ * @param layout Weather layout
+ * @param dy Vertical shift of everything below the status bar
+ * @param sunY Baseline of the sunrise/sunset times
+ */
+constexpr ScreenLayout layoutWithoutWeather(ScreenLayout layout, int16_t dy, int16_t sunY)
+{
+    IndoorLayout &in = layout.indoor;
+    in.date.y += dy;
+    in.weekday.y += dy;
+    in.tempDegree.y += dy;
+    in.temp.y += dy;
+    in.tempUnit.y += dy;
+    in.separators[0].y += dy;
+    in.separators[1].y += dy;
+    in.humidity.y += dy;
+    in.pressure.y += dy;
+    in.highLow[0].y += dy;
+    in.highLow[1].y += dy;
+    in.highLowDegree.y += dy;
+    layout.sky.sun[0].y = sunY;
+    layout.sky.sun[1].y = sunY;
+    return layout;
+}
+
+// Tables for one panel resolution, a missing specialization means the panel
+// in hal.h has no layout yet
+template <uint16_t Width, uint16_t Height>
+struct Layouts;
+
+template <>
+struct Layouts<400, 300>
+{
+    static constexpr ScreenLayout weather = {
+        {270, 0},
+        {
+            {28, 11, u8g2_font_luRS08_tf},
+            {63, 11},
+            {123, 11},
+            {295, 11},
+            {10, 75, u8g2_font_logisoso20_tf},
+            {10, 105},
+            {320, 60, u8g2_font_inb19_mf},
+            {150, 110, u8g2_font_logisoso58_tf},
+            {330, 110},
+            {{0, 121, 400, 2}, {0, 154, 400, 2}},
+            {2, 150, u8g2_font_logisoso20_tf},
+            {264, 150},
+            {{85, 148, u8g2_font_logisoso16_tf}, {180, 148, u8g2_font_logisoso16_tf}},
+            {63, 138, u8g2_font_fub11_tf},
+            73,
+        },
+        {
+            {29, 170, u8g2_font_helvB10_tf},
+            {20, 200, u8g2_font_fub20_tf},
+            30,
+            {22, 185, u8g2_font_fub11_tf},
+            {5, 220, u8g2_font_fur11_tf},
+            75,
+            16,
+            {13, 211, u8g2_font_baby_tf},
+            {5, 245, u8g2_font_fur14_tf},
+            {5, 270},
+            {5, 294, u8g2_font_helvB10_tf},
+            u8g2_font_fur11_tf,
+            {{136, 155, 2, 144}, {320, 155, 2, 144}, {320, 230, 80, 2}},
+            {361, 189},
+            15,
+            {330, 160},
+            60,
+            {330, 227, u8g2_font_luRS08_tf},
+            25,
+        },
+        {
+            {{166, 175, u8g2_font_fur11_tf}, {281, 175, u8g2_font_fur11_tf}},
+            {152, 267},
+            -5,
+            {360, 260},
+            20,
+            {330, 297, u8g2_font_luRS08_tf},
+        },
+    };
+
+    // WiFi off and battery critical: no weather, indoor readings centred
+    static constexpr ScreenLayout wifiOff = layoutWithoutWeather(weather, 40, 255);
+    static constexpr const ScreenLayout &batteryCritical = wifiOff;
+
+    static constexpr LayoutRect night = {0, 0, 400, 300}; // full screen sleep image
+
+    static constexpr LayoutRect widgets[WIDGET_COUNT] = {
+        {0, 0, 400, 14},      // WIDGET_STATUS
+        {0, 14, 400, 18},     // WIDGET_ALERT
+        {0, 40, 144, 80},     // WIDGET_DATE
+        {144, 32, 256, 88},   // WIDGET_INDOOR
+        {0, 120, 400, 36},    // WIDGET_ENV
+        {0, 156, 136, 144},   // WIDGET_OUTDOOR
+        {138, 156, 182, 34},  // WIDGET_SUN
+        {322, 156, 78, 74},   // WIDGET_ICON
+        {322, 232, 78, 68},   // WIDGET_MOON
+    };
+};
+
+// Layouts of the panel selected in hal.h
+typedef Layouts<decltype(EpdDisplay::epd2)::WIDTH, decltype(EpdDisplay::epd2)::HEIGHT> PanelLayouts;
+
+#endif
@@ -0,0 +1,38 @@
+#include "packbits.h"
+
+/**
+ * @brief Unpacks the next bytes of the image
+ * @param out Destination, len bytes
+ * @param len Number of bytes wanted, runs may end and start anywhere inside
+ * @return size_t Bytes unpacked, less than len only at the end of the image
+ */
+size_t PackBitsReader::read(uint8_t *out, size_t len)
+{
+    size_t done = 0;
+    while (done < len)
+    {
+        if (!count)
+        {
+            if (src >= end)
+                break;
+            const int8_t n = pgm_read_byte(src++);
+            if (n == -128) // no-op
+                continue;
+            repeat = n < 0;
+            count = repeat ? 1 - n : n + 1;
+            if (repeat)
+                value = pgm_read_byte(src++);
+        }
+        const size_t step = count < len - done ? count : len - done;
+        if (repeat)
+            memset(out + done, value, step);
+        else
+        {
+            memcpy_P(out + done, src, step);
+            src += step;
+        }
+        count -= step;
+        done += step;
+    }
+    return done;
+}
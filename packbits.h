@@ -0,0 +1,43 @@
+#ifndef PACKBITS_H
+#define PACKBITS_H
+
+// PackBits compressed 1bpp images in flash, see tools/pack_images.cpp. The
+// reader unpacks any number of bytes at a time, so a full screen image can
+// go to the panel or into a frame buffer band by band without ever being
+// held unpacked as a whole. Arduino.h is only pulled in on the board, so
+// the tools can use the reader on the PC.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef ARDUINO
+#include <Arduino.h> // pgm_read_byte, the tools define their own
+#endif
+
+/**
+ * @brief Packed image as written by tools/pack_images.cpp
+ */
+struct PackedImage
+{
+    uint16_t w, h;       // pixels, rows padded to whole bytes
+    uint16_t size;       // packed bytes
+    const uint8_t *data; // PackBits, PROGMEM, unpacks to 1 = white like the panel RAM
+};
+
+class PackBitsReader
+{
+public:
+    explicit PackBitsReader(const PackedImage &image)
+        : src(image.data), end(image.data + image.size), count(0), repeat(false), value(0) {}
+
+    size_t read(uint8_t *out, size_t len);
+
+private:
+    const uint8_t *src; // next packed byte
+    const uint8_t *end;
+    uint8_t count;      // bytes left of the current run
+    bool repeat;        // the run is one byte repeated, else literal bytes
+    uint8_t value;      // the repeated byte
+};
+
+#endif
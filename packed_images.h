@@ -0,0 +1,206 @@
+#ifndef PACKED_IMAGES_H
+#define PACKED_IMAGES_H
+
+// Generated by tools/pack_images.cpp from the PBM files in resources/, do
+// not edit. Full screen images, PackBits compressed, read with PackBitsReader.
+
+#include "packbits.h"
+
+const uint8_t nightModePacked[] PROGMEM = {
+    0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+    0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+    0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xc8,0x00,0x00,0x01,
+    0xff,0xff,0x00,0xfe,0xd3,0x00,0x00,0x03,0xfe,0xff,0xd3,0x00,0x00,0x03,0xfe,0xff,
+    0x00,0x80,0xd4,0x00,0x00,0x07,0xfe,0xff,0x00,0x80,0xd4,0x00,0x00,0x03,0xfe,0xff,
+    0x00,0x80,0xd4,0x00,0x00,0x03,0xfe,0xff,0xd3,0x00,0x00,0x01,0xff,0xff,0x00,0xfe,
+    0xd1,0x00,0x01,0x07,0xfe,0xd1,0x00,0x01,0x0f,0xfc,0xd1,0x00,0x01,0x0f,0xf8,0xd1,
+    0x00,0x01,0x1f,0xf0,0xd1,0x00,0x01,0x3f,0xe0,0xd1,0x00,0x01,0x7f,0xe0,0xd1,0x00,
+    0x01,0x7f,0xc0,0xd1,0x00,0x01,0xff,0x80,0xd2,0x00,0x01,0x01,0xff,0xd1,0x00,0x01,
+    0x03,0xff,0xd1,0x00,0x01,0x07,0xfe,0xd1,0x00,0x01,0x07,0xfc,0xd1,0x00,0x01,0x0f,
+    0xf8,0xd1,0x00,0x01,0x1f,0xf8,0xd1,0x00,0x01,0x3f,0xf0,0xd1,0x00,0x01,0x3f,0xe0,
+    0xd1,0x00,0x01,0x7f,0xc0,0xd1,0x00,0x01,0xff,0x80,0xd2,0x00,0x00,0x01,0xff,0xff,
+    0x00,0xfc,0xd3,0x00,0x00,0x03,0xfe,0xff,0xd3,0x00,0x00,0x03,0xfe,0xff,0xd3,0x00,
+    0x00,0x07,0xfe,0xff,0x00,0x80,0xd4,0x00,0x00,0x07,0xfe,0xff,0x00,0x80,0xd4,0x00,
+    0x00,0x03,0xfe,0xff,0x00,0x80,0xd4,0x00,0x00,0x03,0xfe,0xff,0xd2,0x00,0xff,0xff,
+    0x00,0xfe,0x81,0x00,0xf2,0x00,0x02,0x3f,0xff,0xf0,0xd2,0x00,0x02,0x7f,0xff,0xf8,
+    0xd2,0x00,0xff,0xff,0x00,0xfc,0xd2,0x00,0xff,0xff,0x00,0xfc,0xd2,0x00,0xff,0xff,
+    0x00,0xfc,0xd2,0x00,0xff,0xff,0x00,0xfc,0xd2,0x00,0x02,0x7f,0xff,0xf8,0xd2,0x00,
+    0x02,0x1f,0xff,0xf0,0xd1,0x00,0x01,0x3f,0xe0,0xd1,0x00,0x01,0x7f,0xe0,0xd1,0x00,
+    0x01,0xff,0xc0,0xd1,0x00,0x01,0xff,0x80,0xd2,0x00,0x01,0x01,0xff,0xd9,0x00,0x01,
+    0x07,0xf0,0xfb,0x00,0x01,0x03,0xfe,0xd9,0x00,0x01,0x3f,0xfc,0xfb,0x00,0x01,0x07,
+    0xfe,0xd9,0x00,0x01,0x7f,0xff,0xfb,0x00,0x01,0x07,0xfc,0xd9,0x00,0xff,0xff,0x00,
+    0x80,0xfc,0x00,0x01,0x0f,0xf8,0xda,0x00,0x00,0x01,0xff,0xff,0x00,0xc0,0xfc,0x00,
+    0x01,0x1f,0xf0,0xda,0x00,0x00,0x03,0xff,0xff,0x00,0xe0,0xfc,0x00,0x01,0x3f,0xf0,
+    0xda,0x00,0x00,0x07,0xff,0xff,0x00,0xf0,0xfc,0x00,0x02,0x7f,0xff,0xf0,0xdb,0x00,
+    0x00,0x0f,0xff,0xff,0x00,0xf0,0xfc,0x00,0x02,0x7f,0xff,0xf8,0xdb,0x00,0x00,0x0f,
+    0xff,0xff,0x00,0xf8,0xfc,0x00,0xff,0xff,0x00,0xfc,0xdb,0x00,0x00,0x0f,0xff,0xff,
+    0x00,0xf8,0xfc,0x00,0xff,0xff,0x00,0xfc,0xdb,0x00,0x00,0x1f,0xff,0xff,0x00,0xf8,
+    0xfc,0x00,0xff,0xff,0x00,0xfc,0xdb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xfc,0x00,
+    0xff,0xff,0x00,0xfc,0xdb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xfc,0x00,0x02,0x7f,
+    0xff,0xf8,0xdb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xfa,0x00,0x00,0x20,0xdb,0x00,
+    0x00,0x1f,0xff,0xff,0x00,0xfc,0xd3,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xd3,0x00,
+    0x00,0x1f,0xff,0xff,0x00,0xfc,0xd3,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xd3,0x00,
+    0x00,0x1f,0xff,0xff,0x00,0xfc,0xd3,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xd3,0x00,
+    0x00,0x1f,0xff,0xff,0x00,0xfc,0xff,0x00,0x01,0xff,0xc0,0xd7,0x00,0x00,0x1f,0xff,
+    0xff,0x04,0xfc,0x00,0x07,0xff,0xf8,0xd7,0x00,0x00,0x1f,0xff,0xff,0x04,0xfc,0x00,
+    0x0f,0xff,0xfe,0xd7,0x00,0x00,0x1f,0xff,0xff,0x02,0xfc,0x00,0x3f,0xff,0xff,0xd7,
+    0x00,0x00,0x1f,0xff,0xff,0x02,0xfc,0x00,0x7f,0xff,0xff,0x00,0x80,0xd8,0x00,0x00,
+    0x1f,0xff,0xff,0x01,0xfc,0x00,0xfe,0xff,0x00,0xc0,0xfb,0x00,0x01,0xff,0xf0,0xe0,
+    0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x01,0xfe,0xff,0x00,0xe0,0xfd,0x00,0x00,0x3f,
+    0xfd,0xff,0x00,0xf0,0xe2,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x03,0xfe,0xff,0x00,
+    0xf0,0xfe,0x00,0x00,0x1f,0xfb,0xff,0x00,0xf0,0xe3,0x00,0x00,0x1f,0xff,0xff,0x01,
+    0xfc,0x03,0xfe,0xff,0x00,0xf0,0xff,0x00,0x00,0x07,0xf9,0xff,0x00,0xe0,0xe4,0x00,
+    0x00,0x1f,0xff,0xff,0x01,0xfc,0x07,0xfe,0xff,0x00,0xf8,0xff,0x00,0xf7,0xff,0xe4,
+    0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x07,0xfe,0xff,0x02,0xf8,0x00,0x07,0xf7,0xff,
+    0x00,0xf8,0xe5,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x0f,0xfe,0xff,0x02,0xfc,0x00,
+    0x7f,0xf6,0xff,0x00,0x80,0xe6,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x0f,0xfe,0xff,
+    0x01,0xfc,0x01,0xf5,0xff,0x00,0xf8,0xe6,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x0f,
+    0xfe,0xff,0x01,0xfc,0x03,0xf4,0xff,0xe6,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x0f,
+    0xfe,0xff,0x01,0xfe,0x07,0xf4,0xff,0x00,0xc0,0xe7,0x00,0x00,0x1f,0xff,0xff,0x01,
+    0xfc,0x1f,0xfe,0xff,0x01,0xfe,0x0f,0xf4,0xff,0x00,0xf0,0xe7,0x00,0x00,0x1f,0xff,
+    0xff,0x01,0xfc,0x1f,0xfe,0xff,0x01,0xfe,0x1f,0xf4,0xff,0x00,0xf8,0xe7,0x00,0x00,
+    0x1f,0xff,0xff,0x01,0xfc,0x1f,0xfe,0xff,0x01,0xfe,0x1f,0xf4,0xff,0x03,0xfc,0x00,
+    0x03,0xff,0xea,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x1f,0xfe,0xff,0x01,0xfe,0x3f,
+    0xf4,0xff,0x04,0xfe,0x00,0x0f,0xff,0xc0,0xeb,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,
+    0x1f,0xfe,0xff,0x01,0xfe,0x3f,0xf4,0xff,0x04,0xfe,0x00,0x3f,0xff,0xe0,0xeb,0x00,
+    0x00,0x1f,0xff,0xff,0x01,0xfc,0x0f,0xfe,0xff,0x01,0xfe,0x3f,0xf3,0xff,0x03,0x00,
+    0x7f,0xff,0xf0,0xeb,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x0f,0xfe,0xff,0x01,0xfc,
+    0x3f,0xf3,0xff,0x00,0x00,0xff,0xff,0x00,0xf8,0xeb,0x00,0x00,0x1f,0xff,0xff,0x01,
+    0xfc,0x0f,0xfe,0xff,0x01,0xfc,0x3f,0xf3,0xff,0x00,0x00,0xff,0xff,0x00,0xfc,0xeb,
+    0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x0f,0xfe,0xff,0x01,0xfc,0x3f,0xf3,0xff,0x00,
+    0x01,0xff,0xff,0x00,0xfc,0xeb,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x07,0xfe,0xff,
+    0x01,0xf8,0x3f,0xf3,0xff,0x00,0x01,0xff,0xff,0x00,0xfe,0xeb,0x00,0x00,0x1f,0xff,
+    0xff,0x01,0xfc,0x07,0xfe,0xff,0x01,0xf8,0x3f,0xf3,0xff,0x00,0x03,0xff,0xff,0x00,
+    0xfe,0xeb,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x03,0xfe,0xff,0x01,0xf0,0x3f,0xf3,
+    0xff,0x00,0x03,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x01,0xfc,0x03,0xfe,0xff,
+    0x01,0xf0,0x3f,0xf3,0xff,0x00,0x03,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x01,
+    0xfc,0x01,0xfe,0xff,0x01,0xe0,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,
+    0x1f,0xff,0xff,0x01,0xfc,0x00,0xfe,0xff,0x01,0xc0,0x3f,0xf3,0xff,0x00,0x07,0xfe,
+    0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x02,0xfc,0x00,0x7f,0xff,0xff,0x01,0x80,0x3f,
+    0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x02,0xfc,0x00,0x3f,
+    0xff,0xff,0x01,0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,
+    0xff,0x06,0xfc,0x00,0x0f,0xff,0xfc,0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,
+    0x00,0x00,0x1f,0xff,0xff,0x06,0xfc,0x00,0x03,0xff,0xf8,0x00,0x3f,0xf3,0xff,0x00,
+    0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xff,0x00,0x03,0xff,0xc0,
+    0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,
+    0xfc,0x00,0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,
+    0x00,0xfc,0xfc,0x00,0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,
+    0xff,0xff,0x00,0xfc,0xfc,0x00,0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xff,0xff,0x00,0xfc,0xfc,0x00,0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,
+    0xeb,0x00,0x00,0x1f,0xfb,0xff,0x02,0xfc,0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,
+    0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0x00,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,
+    0x00,0x00,0x1f,0xfa,0xff,0x01,0x80,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xfa,0xff,0x01,0xc0,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,
+    0x1f,0xfa,0xff,0x01,0xe0,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,
+    0xfa,0xff,0x01,0xf0,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,
+    0xff,0x01,0xf0,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,
+    0x01,0xf0,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,
+    0xf8,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,
+    0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,
+    0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,0xf3,
+    0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,0xf3,0xff,
+    0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,0xf3,0xff,0x00,
+    0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,0xf3,0xff,0x00,0x07,
+    0xfe,0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,0xf3,0xff,0x00,0x07,0xfe,
+    0xff,0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,
+    0xeb,0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,
+    0x00,0x00,0x1f,0xfa,0xff,0x01,0xf8,0x3f,0xf3,0xff,0x00,0x07,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xfa,0xff,0x01,0xf8,0x1f,0xf4,0xff,0x01,0xfe,0x07,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xfa,0xff,0x01,0xfc,0x1f,0xf4,0xff,0x01,0xfe,0x0f,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xfa,0xff,0x01,0xfc,0x0f,0xf4,0xff,0x01,0xfc,0x0f,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xfa,0xff,0x01,0xfe,0x07,0xf4,0xff,0x01,0xf8,0x1f,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xfa,0xff,0x01,0xfe,0x03,0xf4,0xff,0x01,0xf0,0x1f,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xf9,0xff,0x00,0x00,0xf4,0xff,0x01,0xc0,0x3f,0xfe,0xff,0xeb,0x00,0x00,
+    0x1f,0xf9,0xff,0x01,0x80,0x1f,0xf6,0xff,0x02,0xfe,0x00,0x7f,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xf9,0xff,0x00,0xc0,0xf3,0x00,0xfd,0xff,0xeb,0x00,0x00,0x1f,0xf9,0xff,
+    0x00,0xe0,0xf4,0x00,0x00,0x01,0xfd,0xff,0xeb,0x00,0x00,0x1f,0xf9,0xff,0x00,0xf0,
+    0xf4,0x00,0x00,0x03,0xfd,0xff,0xeb,0x00,0x00,0x1f,0xf9,0xff,0x00,0xfc,0xf4,0x00,
+    0x00,0x0f,0xfd,0xff,0xeb,0x00,0x00,0x1f,0xf8,0xff,0x00,0xc0,0xf5,0x00,0xfc,0xff,
+    0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,
+    0xe6,0xff,0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,
+    0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,0xe6,0xff,
+    0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,
+    0xe6,0xff,0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,0xe6,0xff,0xeb,0x00,
+    0x00,0x1f,0xe6,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,
+    0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,
+    0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,
+    0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,
+    0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,
+    0xed,0x00,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,
+    0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,
+    0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,
+    0xeb,0x00,0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,0xeb,0x00,
+    0x00,0x1f,0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,
+    0xff,0xff,0x00,0xfc,0xed,0x00,0x00,0x07,0xfe,0xff,0xeb,0x00,0x00,0x1f,0xff,0xff,
+    0x00,0xf8,0xed,0x00,0x00,0x03,0xfe,0xff,0xeb,0x00,0x00,0x0f,0xff,0xff,0x00,0xf8,
+    0xed,0x00,0x00,0x03,0xff,0xff,0x00,0xfe,0xeb,0x00,0x00,0x0f,0xff,0xff,0x00,0xf8,
+    0xed,0x00,0x00,0x03,0xff,0xff,0x00,0xfe,0xeb,0x00,0x00,0x0f,0xff,0xff,0x00,0xf0,
+    0xed,0x00,0x00,0x01,0xff,0xff,0x00,0xfe,0xeb,0x00,0x00,0x07,0xff,0xff,0x00,0xf0,
+    0xed,0x00,0x00,0x01,0xff,0xff,0x00,0xfc,0xeb,0x00,0x00,0x03,0xff,0xff,0x00,0xe0,
+    0xec,0x00,0xff,0xff,0x00,0xf8,0xeb,0x00,0x00,0x01,0xff,0xff,0x00,0xc0,0xec,0x00,
+    0x02,0x7f,0xff,0xf8,0xeb,0x00,0x00,0x01,0xff,0xff,0x00,0x80,0xec,0x00,0x02,0x3f,
+    0xff,0xf0,0xea,0x00,0x01,0x7f,0xff,0xeb,0x00,0x02,0x1f,0xff,0xc0,0xea,0x00,0x01,
+    0x3f,0xfe,0xeb,0x00,0x02,0x07,0xff,0x80,0xea,0x00,0x01,0x07,0xf0,0xeb,0x00,0x01,
+    0x01,0xfc,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+    0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+    0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+    0x81,0x00,0x81,0x00,0x81,0x00,0xdf,0x00
+};
+
+constexpr PackedImage nightMode = {400, 300, 2216, nightModePacked}; // 15000 bytes unpacked
+
+const uint8_t alertPacked[] PROGMEM = {
+    0xee,0xff,0x00,0x0f,0xf6,0xff,0x01,0xfc,0x03,0xf6,0xff,0x01,0xf8,0x01,0xf6,0xff,
+    0x01,0xf0,0x00,0xf6,0xff,0x02,0xe0,0x00,0x7f,0xf7,0xff,0x02,0xe0,0x00,0x3f,0xf7,
+    0xff,0x02,0xc0,0x00,0x3f,0xf7,0xff,0x02,0x80,0x00,0x1f,0xf7,0xff,0x02,0x80,0x00,
+    0x1f,0xf7,0xff,0xff,0x00,0x00,0x0f,0xf7,0xff,0xff,0x00,0x00,0x0f,0xf8,0xff,0x00,
+    0xfe,0xff,0x00,0x00,0x07,0xf8,0xff,0x00,0xfc,0xff,0x00,0x00,0x03,0xf8,0xff,0x00,
+    0xfc,0xff,0x00,0x00,0x03,0xf8,0xff,0x00,0xf8,0xff,0x00,0x00,0x01,0xf8,0xff,0x00,
+    0xf8,0xff,0x00,0x00,0x01,0xf8,0xff,0x00,0xf0,0xfe,0x00,0xf8,0xff,0x00,0xf0,0xfe,
+    0x00,0x00,0x7f,0xf9,0xff,0x00,0xe0,0xfe,0x00,0x00,0x7f,0xf9,0xff,0x00,0xc0,0xfe,
+    0x00,0x00,0x3f,0xf9,0xff,0x00,0xc0,0xfe,0x00,0x00,0x3f,0xf9,0xff,0x00,0x80,0xfe,
+    0x00,0x00,0x1f,0xf9,0xff,0x00,0x80,0xfe,0x00,0x00,0x0f,0xf9,0xff,0xfd,0x00,0x00,
+    0x0f,0xfa,0xff,0x00,0xfe,0xfd,0x00,0x00,0x07,0xfa,0xff,0x05,0xfe,0x00,0x01,0xf8,
+    0x00,0x07,0xfa,0xff,0x05,0xfc,0x00,0x03,0xfc,0x00,0x03,0xfa,0xff,0x05,0xfc,0x00,
+    0x03,0xfc,0x00,0x01,0xfa,0xff,0x05,0xf8,0x00,0x07,0xfe,0x00,0x01,0xfa,0xff,0x03,
+    0xf0,0x00,0x07,0xfe,0xff,0x00,0xfa,0xff,0x03,0xf0,0x00,0x07,0xfe,0xff,0x00,0xfa,
+    0xff,0x03,0xe0,0x00,0x07,0xfe,0xff,0x00,0x00,0x7f,0xfb,0xff,0x03,0xe0,0x00,0x07,
+    0xfe,0xff,0x00,0x00,0x3f,0xfb,0xff,0x03,0xc0,0x00,0x07,0xfe,0xff,0x00,0x00,0x3f,
+    0xfb,0xff,0x03,0x80,0x00,0x07,0xfe,0xff,0x00,0x00,0x1f,0xfb,0xff,0x03,0x80,0x00,
+    0x07,0xfe,0xff,0x00,0x00,0x1f,0xfb,0xff,0xff,0x00,0x01,0x07,0xfe,0xff,0x00,0x00,
+    0x0f,0xfb,0xff,0xff,0x00,0x01,0x07,0xfe,0xff,0x00,0x00,0x0f,0xfc,0xff,0x00,0xfe,
+    0xff,0x00,0x01,0x07,0xfe,0xff,0x00,0x00,0x07,0xfc,0xff,0x00,0xfc,0xff,0x00,0x01,
+    0x07,0xfe,0xff,0x00,0x00,0x03,0xfc,0xff,0x00,0xfc,0xff,0x00,0x01,0x07,0xfe,0xff,
+    0x00,0x00,0x03,0xfc,0xff,0x00,0xf8,0xff,0x00,0x01,0x07,0xfe,0xff,0x00,0x00,0x01,
+    0xfc,0xff,0x00,0xf8,0xff,0x00,0x01,0x07,0xfe,0xff,0x00,0x00,0x01,0xfc,0xff,0x00,
+    0xf0,0xff,0x00,0x01,0x07,0xfe,0xfe,0x00,0xfc,0xff,0x00,0xe0,0xff,0x00,0x01,0x07,
+    0xfe,0xfe,0x00,0x00,0x7f,0xfd,0xff,0x00,0xe0,0xff,0x00,0x01,0x07,0xfe,0xfe,0x00,
+    0x00,0x7f,0xfd,0xff,0x00,0xc0,0xff,0x00,0x01,0x07,0xfe,0xfe,0x00,0x00,0x3f,0xfd,
+    0xff,0x00,0xc0,0xff,0x00,0x01,0x07,0xfe,0xfe,0x00,0x00,0x3f,0xfd,0xff,0x00,0x80,
+    0xff,0x00,0x01,0x07,0xfe,0xfe,0x00,0x00,0x1f,0xfd,0xff,0x00,0x80,0xff,0x00,0x01,
+    0x07,0xfe,0xfe,0x00,0x00,0x0f,0xfd,0xff,0xfe,0x00,0x01,0x07,0xfe,0xfe,0x00,0x00,
+    0x0f,0xfe,0xff,0x00,0xfe,0xfe,0x00,0x01,0x07,0xfe,0xfe,0x00,0x00,0x07,0xfe,0xff,
+    0x00,0xfe,0xfe,0x00,0x01,0x07,0xfe,0xfe,0x00,0x00,0x07,0xfe,0xff,0x00,0xfc,0xfe,
+    0x00,0x01,0x03,0xfc,0xfe,0x00,0x00,0x03,0xfe,0xff,0x00,0xfc,0xfe,0x00,0x01,0x01,
+    0xf8,0xfe,0x00,0x00,0x01,0xfe,0xff,0x00,0xf8,0xfd,0x00,0x00,0x60,0xfe,0x00,0x00,
+    0x01,0xfe,0xff,0x00,0xf0,0xf8,0x00,0xfe,0xff,0x00,0xf0,0xf8,0x00,0xfe,0xff,0x00,
+    0xe0,0xf8,0x00,0x00,0x7f,0xff,0xff,0x00,0xe0,0xf8,0x00,0x00,0x7f,0xff,0xff,0x00,
+    0xc0,0xf8,0x00,0x00,0x3f,0xff,0xff,0x00,0x80,0xf8,0x00,0x00,0x1f,0xff,0xff,0x00,
+    0x80,0xfe,0x00,0x01,0x03,0xf8,0xfd,0x00,0x00,0x1f,0xff,0xff,0xfd,0x00,0x01,0x07,
+    0xfe,0xfd,0x00,0x00,0x0f,0xff,0xff,0xfd,0x00,0x01,0x07,0xff,0xfd,0x00,0x02,0x0f,
+    0xff,0xfe,0xfd,0x00,0x01,0x0f,0xff,0xfd,0x00,0x02,0x07,0xff,0xfc,0xfd,0x00,0x01,
+    0x0f,0xff,0xfd,0x00,0x02,0x03,0xff,0xfc,0xfd,0x00,0x01,0x0f,0xff,0xfd,0x00,0x02,
+    0x03,0xff,0xf8,0xfd,0x00,0x01,0x0f,0xff,0xfd,0x00,0x02,0x01,0xff,0xf8,0xfd,0x00,
+    0x01,0x0f,0xff,0xfd,0x00,0x02,0x01,0xff,0xf0,0xfd,0x00,0x01,0x0f,0xff,0xfc,0x00,
+    0x01,0xff,0xe0,0xfd,0x00,0x01,0x07,0xfe,0xfc,0x00,0x01,0x7f,0xe0,0xfd,0x00,0x01,
+    0x07,0xfe,0xfc,0x00,0x01,0x7f,0xc0,0xfd,0x00,0x01,0x01,0xf8,0xfc,0x00,0x01,0x3f,
+    0xc0,0xf6,0x00,0x01,0x3f,0x80,0xf6,0x00,0x01,0x1f,0x80,0xf6,0x00,0x01,0x1f,0x80,
+    0xf6,0x00,0x00,0x1f,0xf5,0x00,0x01,0x0f,0x80,0xf6,0x00,0x01,0x1f,0x80,0xf6,0x00,
+    0x01,0x1f,0x80,0xf6,0x00,0x01,0x1f,0x80,0xf6,0x00,0x01,0x1f,0xc0,0xf6,0x00,0x01,
+    0x3f,0xe0,0xf6,0x00,0x01,0x7f,0xf8,0xf7,0x00,0x00,0x01,0xd9,0xff
+};
+
+constexpr PackedImage alert = {100, 90, 765, alertPacked}; // 1170 bytes unpacked
+
+#endif
@@ -0,0 +1,105 @@
+#include "perf.h"
+#include "hal.h"
+
+static const char *const phaseNames[PERF_PHASE_COUNT] = {
+    "boot", "display.init", "BH1750 wait", "sensor init", "wifi connect", "time update", "dns",
+    "dns saved", "fetch OWM", "fetch custom", "json parse", "render", "refresh", "nvs write"};
+
+static RTC_DATA_ATTR PerfCycle perfRing[PERF_CYCLES];
+static RTC_DATA_ATTR uint32_t perfSeq = 0; // total committed cycles
+
+static PerfCycle current;
+static int64_t phaseStart[PERF_PHASE_COUNT]; // 0 when the phase is not running
+
+/**
+ * @brief Starts timing a new wake, call first thing in setup()
+ */
+void perfStart()
+{
+    memset(&current, 0, sizeof(current));
+    memset(phaseStart, 0, sizeof(phaseStart));
+    current.phaseUs[PERF_BOOT] = halMicros(); // esp_timer starts at reset
+}
+
+void perfBegin(PerfPhase phase)
+{
+    phaseStart[phase] = halMicros();
+}
+
+// Adds the time since perfBegin(), no-op when the phase was not started
+void perfEnd(PerfPhase phase)
+{
+    if (phaseStart[phase] == 0)
+        return;
+    current.phaseUs[phase] += halMicros() - phaseStart[phase];
+    phaseStart[phase] = 0;
+}
+
+// Adds a duration measured elsewhere, e.g. by a request running in the background
+void perfAdd(PerfPhase phase, uint32_t us)
+{
+    current.phaseUs[phase] += us;
+}
+
+/**
+ * @brief Stores the current wake in the RTC ring, call right before deep sleep
+ */
+void perfCommit()
+{
+    current.seq = perfSeq;
+    current.awakeUs = halMicros();
+    current.minFreeHeap = halMinFreeHeap();
+    perfRing[perfSeq % PERF_CYCLES] = current;
+    perfSeq++;
+}
+
+/**
+ * @brief Formats the stored cycles, oldest first, plus the running one
+ * @return String Plain text table in milliseconds
+ */
+String perfReport(bool inMicros)
+{
+    String out;
+    const uint32_t unit = inMicros ? 1 : 1000;
+    uint32_t first = perfSeq > PERF_CYCLES ? perfSeq - PERF_CYCLES : 0;
+    char line[48];
+
+    out += inMicros ? "phase (us)" : "phase (ms)";
+    for (uint32_t c = first; c < perfSeq; c++)
+    {
+        snprintf(line, sizeof(line), "\t#%lu", (unsigned long)perfRing[c % PERF_CYCLES].seq);
+        out += line;
+    }
+    out += "\tnow\n";
+
+    for (uint8_t p = 0; p < PERF_PHASE_COUNT; p++)
+    {
+        out += phaseNames[p];
+        for (uint32_t c = first; c < perfSeq; c++)
+        {
+            snprintf(line, sizeof(line), "\t%lu", (unsigned long)(perfRing[c % PERF_CYCLES].phaseUs[p] / unit));
+            out += line;
+        }
+        snprintf(line, sizeof(line), "\t%lu\n", (unsigned long)(current.phaseUs[p] / unit));
+        out += line;
+    }
+
+    out += "awake";
+    for (uint32_t c = first; c < perfSeq; c++)
+    {
+        snprintf(line, sizeof(line), "\t%lu", (unsigned long)(perfRing[c % PERF_CYCLES].awakeUs / unit));
+        out += line;
+    }
+    snprintf(line, sizeof(line), "\t%lu\n", (unsigned long)(halMicros() / unit));
+    out += line;
+
+    out += "min heap (B)";
+    for (uint32_t c = first; c < perfSeq; c++)
+    {
+        snprintf(line, sizeof(line), "\t%lu", (unsigned long)perfRing[c % PERF_CYCLES].minFreeHeap);
+        out += line;
+    }
+    snprintf(line, sizeof(line), "\t%lu\n", (unsigned long)halMinFreeHeap());
+    out += line;
+    return out;
+}
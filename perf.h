@@ -0,0 +1,47 @@
+#ifndef PERF_H
+#define PERF_H
+
+// Wake cycle timing. Every phase of setup() accumulates its duration in
+// microseconds; at the end of the wake the totals are pushed into a ring of
+// the last PERF_CYCLES wakes kept in RTC memory, so it survives deep sleep.
+
+#include <Arduino.h>
+
+#define PERF_CYCLES 8 // number of wake cycles kept in RTC memory
+
+enum PerfPhase : uint8_t
+{
+    PERF_BOOT,         // reset to start of setup()
+    PERF_DISPLAY_INIT, // display.init()
+    PERF_LIGHT_WAIT,   // BH1750 one-shot conversion
+    PERF_SENSOR_INIT,  // RTC, TMP117 and BME680 begin
+    PERF_WIFI_CONNECT, // WiFi.begin() to waitForConnectResult()
+    PERF_TIME_UPDATE,  // autoTimeUpdate()
+    PERF_DNS,          // host lookups, 0 when both addresses were cached
+    PERF_DNS_SAVED,    // lookups skipped by the RTC cache, at their last measured time
+    PERF_FETCH_OWM,    // OpenWeatherMap request latency
+    PERF_FETCH_CUSTOM, // custom server request latency, overlaps the one above
+    PERF_JSON_PARSE,   // response parsing, runs inside the fetch phases
+    PERF_RENDER,       // drawing into the frame buffer
+    PERF_REFRESH,      // frame transfer and panel refresh
+    PERF_NVS_WRITE,    // preferences written before sleep
+    PERF_PHASE_COUNT
+};
+
+struct PerfCycle
+{
+    uint32_t seq;                       // wake number since power on
+    uint32_t awakeUs;                   // reset to deep sleep
+    uint32_t minFreeHeap;               // lowest free heap during the wake
+    uint32_t phaseUs[PERF_PHASE_COUNT]; // accumulated time per phase
+};
+
+void perfStart();
+void perfBegin(PerfPhase phase);
+void perfEnd(PerfPhase phase);
+void perfAdd(PerfPhase phase, uint32_t us);
+void perfCommit();
+
+String perfReport(bool inMicros = false); // table in us instead of ms, for the host build
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+// Plain data gathered once per wake by the acquisition stage. The render
+// stage only reads these, so drawing the same frame in several pages never
+// touches the sensors or the network again.
+
+#include <stdint.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+/**
+ * @brief Indoor sensors, battery and clock readings
+ */
+struct IndoorSnapshot
+{
+    uint8_t hour, minute;     // RTC local time
+    uint8_t day, month, wday; // month 1-12, wday 0 = Sunday
+    float tempC;              // TMP117, 0 when no data was ready
+    float hTemp, lTemp;       // high and low of the day
+    float battLevel;          // filtered battery voltage
+    int percent;              // battery percentage 0-100
+    bool battCritical;        // below 3%, WiFi is kept off
+    bool envValid;            // false when the BME680 reading failed
+    float humidity;           // %
+    float pressure;           // hPa
+};
+
+/**
+ * @brief Outdoor conditions from OpenWeatherMap and the custom server
+ */
+struct WeatherSnapshot
+{
+    bool valid;           // false when One Call returned no current.temp
+    int httpCode;         // last HTTP response code
+    int8_t rssi;          // WiFi signal strength while fetching
+    char ssid[33];        // network used for the fetch
+    float outdoorTemp;    // custom server data.temp
+    float outdoorHum;     // custom server data.humidity
+    float outdoorPres;    // custom server data.pressure
+    float feelsLike;      // current.feels_like
+    float uvi;            // current.uvi
+    char icon[4];         // current.weather[0].icon, e.g. "01d"
+    char main[16];        // current.weather[0].main
+    char alert[48];       // alerts[0].event, empty when there is none
+};
+
+/**
+ * @brief Sun and moon, computed locally from lat/lon and the RTC
+ */
+struct SkySnapshot
+{
+    uint32_t sunrise;     // UTC epoch, 0 on polar day or night
+    uint32_t sunset;      // UTC epoch, 0 on polar day or night
+    float moonPhase;      // 0 new, 0.5 full, same scale as One Call moon_phase
+};
+
+#endif
@@ -0,0 +1,125 @@
+// Host check of the sunrise, sunset and moon phase in astro.h against
+// published times.
+//
+// The sun times are almanac minutes (NOAA solar calculator, timeanddate.com)
+// for solstice and equinox days in both hemispheres and on both sides of the
+// date line, given in UTC. The moon times are new and
+// full moons of solar and lunar eclipses and the quarters of January 2024.
+// Prints the error of every entry and exits with 1 if one is off by more
+// than the accuracy promised in astro.h, or if a polar day or night is not
+// reported as such.
+//
+//   g++ -std=c++17 -O2 -o astro_check tools/astro_check.cpp
+//   ./astro_check
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#include "../astro.cpp"
+
+static const long SUN_TOLERANCE_S = 180;       // about a minute, two or three towards the polar circles
+static const double MOON_TOLERANCE_H = 6.0;     // a few hours, the icon changes every ~3.7 days
+static const double SYNODIC_MONTH_H = 708.734;  // 29.53059 days
+
+struct SunReference
+{
+    const char *place;
+    float lat, lon;
+    uint16_t year;
+    uint8_t month, day;     // local date, as the sketch passes it
+    const char *rise, *set; // UTC
+};
+
+// clang-format off
+static const SunReference SUN[] = {
+    {"London",    51.5074f,  -0.1278f, 2024,  6, 21, "2024-06-21 03:43", "2024-06-21 20:21"},
+    {"London",    51.5074f,  -0.1278f, 2024, 12, 21, "2024-12-21 08:03", "2024-12-21 15:53"},
+    {"New York",  40.7128f, -74.0060f, 2024,  6, 20, "2024-06-20 09:25", "2024-06-21 00:31"},
+    {"Reykjavik", 64.1466f, -21.9426f, 2024,  3, 20, "2024-03-20 07:27", "2024-03-20 19:45"},
+    {"Singapore",  1.3521f, 103.8198f, 2024,  9, 22, "2024-09-21 22:54", "2024-09-22 11:00"},
+    {"Tokyo",     35.6762f, 139.6503f, 2024, 12, 21, "2024-12-20 21:47", "2024-12-21 07:32"},
+    {"Sydney",   -33.8688f, 151.2093f, 2024,  6, 21, "2024-06-20 21:00", "2024-06-21 06:54"},
+    {"Cape Town",-33.9249f,  18.4241f, 2024, 12, 21, "2024-12-21 03:32", "2024-12-21 17:57"},
+};
+// clang-format on
+
+struct MoonReference
+{
+    const char *what;
+    const char *utc;
+    float phase;
+};
+
+static const MoonReference MOON[] = {
+    {"new moon, total solar eclipse", "2017-08-21 18:30", 0.0f},
+    {"new moon, total solar eclipse", "2024-04-08 18:21", 0.0f},
+    {"new moon, annular eclipse", "2024-10-02 18:49", 0.0f},
+    {"full moon, total lunar eclipse", "2022-11-08 11:02", 0.5f},
+    {"full moon, partial lunar eclipse", "2024-09-18 02:34", 0.5f},
+    {"full moon, total lunar eclipse", "2025-03-14 06:55", 0.5f},
+    {"last quarter", "2024-01-04 03:30", 0.75f},
+    {"first quarter", "2024-01-18 03:52", 0.25f},
+};
+
+// "YYYY-MM-DD HH:MM" in UTC to a Unix epoch
+static uint32_t epoch(const char *utc)
+{
+    struct tm t = {};
+    sscanf(utc, "%d-%d-%d %d:%d", &t.tm_year, &t.tm_mon, &t.tm_mday, &t.tm_hour, &t.tm_min);
+    t.tm_year -= 1900;
+    t.tm_mon -= 1;
+    return (uint32_t)timegm(&t);
+}
+
+static int checkSun()
+{
+    int failed = 0;
+    printf("%-10s %-10s %10s %10s\n", "place", "date", "rise err s", "set err s");
+    for (const SunReference &ref : SUN)
+    {
+        uint32_t rise, set;
+        const bool ok = astroSunTimes(ref.year, ref.month, ref.day, ref.lat, ref.lon, rise, set);
+        const long riseErr = (long)rise - (long)epoch(ref.rise);
+        const long setErr = (long)set - (long)epoch(ref.set);
+        const bool pass = ok && labs(riseErr) <= SUN_TOLERANCE_S && labs(setErr) <= SUN_TOLERANCE_S;
+        printf("%-10s %04u-%02u-%02u %10ld %10ld %s\n", ref.place, ref.year, ref.month, ref.day, riseErr, setErr,
+               pass ? "ok" : "FAILED");
+        failed += !pass;
+    }
+
+    // Tromso has midnight sun at the June solstice and polar night at the December one
+    uint32_t rise, set;
+    const bool polarDay = !astroSunTimes(2024, 6, 21, 69.6492f, 18.9553f, rise, set) && rise == 0 && set == 0;
+    const bool polarNight = !astroSunTimes(2024, 12, 21, 69.6492f, 18.9553f, rise, set) && rise == 0 && set == 0;
+    printf("%-10s %-10s %21s %s\n", "Tromso", "2024-06-21", "polar day", polarDay ? "ok" : "FAILED");
+    printf("%-10s %-10s %21s %s\n", "Tromso", "2024-12-21", "polar night", polarNight ? "ok" : "FAILED");
+    return failed + !polarDay + !polarNight;
+}
+
+static int checkMoon()
+{
+    int failed = 0;
+    printf("\n%-34s %-16s %6s %7s\n", "moon", "UTC", "phase", "err h");
+    for (const MoonReference &ref : MOON)
+    {
+        const float phase = astroMoonPhase(epoch(ref.utc));
+        double diff = phase - ref.phase;
+        diff -= floor(diff + 0.5); // wrap to -0.5..0.5, new moon sits at both ends of the scale
+        const double errHours = diff * SYNODIC_MONTH_H;
+        const bool pass = fabs(errHours) <= MOON_TOLERANCE_H;
+        printf("%-34s %-16s %6.4f %7.2f %s\n", ref.what, ref.utc, phase, errHours, pass ? "ok" : "FAILED");
+        failed += !pass;
+    }
+    return failed;
+}
+
+int main()
+{
+    int failed = checkSun();
+    failed += checkMoon();
+    printf("checks: %s\n", failed ? "FAILED" : "ok");
+    return failed ? 1 : 0;
+}
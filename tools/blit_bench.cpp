@@ -0,0 +1,196 @@
+// Host benchmark of the byte-wide bitmap and span drawing in frame_planes.h.
+//
+// Draws the status icons of image.h, the unpacked alert icon and the weather
+// sprites once through a generic path that repeats Adafruit_GFX::drawBitmap()
+// and the GxEPD2_3C drawPixel() (a virtual call per pixel with rotation,
+// window and page checks) and once with FramePlanes::blitRow(), at byte
+// aligned and unaligned x. Both must leave the same planes.
+//
+//   g++ -std=c++17 -O2 -o blit_bench tools/blit_bench.cpp
+//   ./blit_bench
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define memcpy_P memcpy
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+#define GxEPD_RED 0xF800
+
+#include "../frame_planes.h"
+#include "../image.h"
+#include "../packbits.cpp"
+#include "../packed_images.h"
+#define HAL_H // icons.h only needs the colours from hal.h
+#include "../icon_sprites.h"
+
+static const uint16_t WIDTH = 400, HEIGHT = 300;
+typedef FramePlanes<WIDTH, HEIGHT, true> Planes;
+
+// The per pixel path the sketch used before, Adafruit_GFX on top of GxEPD2_3C
+struct PixelSink
+{
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual ~PixelSink() {}
+};
+
+struct GenericFrame : PixelSink
+{
+    Planes &planes;
+    uint8_t rotation = 0;
+    int16_t currentPage = 0;
+    explicit GenericFrame(Planes &p) : planes(p) {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT)
+            return;
+        switch (rotation)
+        {
+        case 1:
+            std::swap(x, y);
+            x = WIDTH - x - 1;
+            break;
+        case 2:
+            x = WIDTH - x - 1;
+            y = HEIGHT - y - 1;
+            break;
+        case 3:
+            std::swap(x, y);
+            y = HEIGHT - y - 1;
+            break;
+        }
+        y -= currentPage * HEIGHT;
+        if (y < 0 || y >= int16_t(HEIGHT))
+            return;
+        const uint16_t i = x / 8 + y * (WIDTH / 8);
+        const uint8_t bit = 0x80 >> (x % 8);
+        planes.black[i] |= bit;
+        planes.red[i] |= bit;
+        if (color == GxEPD_BLACK)
+            planes.black[i] &= ~bit;
+        else if (color == GxEPD_RED)
+            planes.red[i] &= ~bit;
+    }
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+    {
+        const int16_t byteWidth = (w + 7) / 8;
+        uint8_t b = 0;
+        for (int16_t j = 0; j < h; j++, y++)
+            for (int16_t i = 0; i < w; i++)
+            {
+                if (i & 7)
+                    b <<= 1;
+                else
+                    b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+                if (b & 0x80)
+                    drawPixel(x + i, y, color);
+            }
+    }
+};
+
+// FramePlanes path, clipped to the screen like EpdFrame::blit()
+static void blitBitmap(Planes &planes, int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+                       PlaneInk ink)
+{
+    const uint16_t rowLen = (w + 7) / 8;
+    const int16_t x0 = std::max<int16_t>(x, 0), x1 = std::min<int16_t>(x + w, WIDTH);
+    const int16_t y0 = std::max<int16_t>(y, 0), y1 = std::min<int16_t>(y + h, HEIGHT);
+    for (int16_t row = y0; row < y1; row++)
+        planes.blitRow(row, x, bitmap + (row - y) * rowLen, rowLen, x0, x1, ink, nullptr);
+}
+
+struct Bitmap
+{
+    const char *name;
+    const uint8_t *bits;
+    int16_t w, h;
+};
+
+static Planes generic, fast;
+
+template <typename F>
+static double nanosPerRun(F run)
+{
+    using namespace std::chrono;
+    const int runs = 2000;
+    const auto start = steady_clock::now();
+    for (int i = 0; i < runs; i++)
+        run();
+    return duration<double, std::nano>(steady_clock::now() - start).count() / runs;
+}
+
+int main()
+{
+    static uint8_t alertBits[(alert.w + 7) / 8 * alert.h];
+    PackBitsReader(alert).read(alertBits, sizeof(alertBits));
+
+    std::vector<Bitmap> bitmaps = {
+        {"wifiOn", wifiOn, 12, 12},
+        {"wifiAvg", wifiAvg, 12, 12},
+        {"wifiOff", wifiOff, 12, 12},
+        {"wifiError", wifiError, 13, 13},
+        {"net", net, 29, 28},
+        {"alert", alertBits, alert.w, alert.h},
+    };
+    for (int i = 0; i < ICON_SPRITE_COUNT; i++)
+    {
+        static char names[ICON_SPRITE_COUNT][16];
+        if (!iconSprites[i].black) // drawn from primitives
+            continue;
+        snprintf(names[i], sizeof(names[i]), "sprite %d", i);
+        bitmaps.push_back({names[i], iconSprites[i].black, iconSprites[i].w, iconSprites[i].h});
+    }
+
+    GenericFrame frame(generic);
+    const PlaneInk black = {false, true};
+    int failed = 0;
+    printf("%-10s %5s %5s %12s %12s %8s\n", "bitmap", "size", "x", "generic ns", "planes ns", "speedup");
+    for (const Bitmap &bitmap : bitmaps)
+        for (int16_t x : {152, 155, 397})
+        {
+            generic.fill({true, true});
+            fast.fill({true, true});
+            frame.drawBitmap(x, 40, bitmap.bits, bitmap.w, bitmap.h, GxEPD_BLACK);
+            blitBitmap(fast, x, 40, bitmap.bits, bitmap.w, bitmap.h, black);
+            const bool same = !memcmp(generic.black, fast.black, sizeof(fast.black)) &&
+                              !memcmp(generic.red, fast.red, sizeof(fast.red));
+            failed += !same;
+
+            const double slow = nanosPerRun([&] { frame.drawBitmap(x, 40, bitmap.bits, bitmap.w, bitmap.h, GxEPD_BLACK); });
+            const double quick = nanosPerRun([&] { blitBitmap(fast, x, 40, bitmap.bits, bitmap.w, bitmap.h, black); });
+            printf("%-10s %2dx%-3d %4d %12.0f %12.0f %7.1fx%s\n", bitmap.name, bitmap.w, bitmap.h, x, slow, quick,
+                   slow / quick, same ? "" : "  MISMATCH");
+        }
+
+    // spans, the fill of fillEllipsis(), fillMoonRows() and the divider lines
+    generic.fill({true, true});
+    fast.fill({true, true});
+    const double slow = nanosPerRun([&] {
+        for (int16_t y = 0; y < 100; y++)
+            for (int16_t x = 3; x < 3 + 2 * y + 1; x++)
+                frame.drawPixel(x, y, GxEPD_BLACK);
+    });
+    const double quick = nanosPerRun([&] {
+        for (int16_t y = 0; y < 100; y++)
+            fast.fillSpan(y, 3, 3 + 2 * y + 1, black);
+    });
+    const bool same = !memcmp(generic.black, fast.black, sizeof(fast.black));
+    failed += !same;
+    printf("%-10s %5s %5s %12.0f %12.0f %7.1fx%s\n", "100 spans", "", "3", slow, quick, slow / quick,
+           same ? "" : "  MISMATCH");
+    return failed ? 1 : 0;
+}
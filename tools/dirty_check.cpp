@@ -0,0 +1,139 @@
+// Host check of the partial refresh window chosen by dirtyWindow() in
+// dirty_region.h, the panel in hal.h has no fast partial update so the path
+// never runs on the board as configured.
+//
+// Runs the typical wakes on the regions of the 400x300 weather layout (a copy
+// of Layouts<400, 300>::widgets in layout.h) and then random boxes and dirty
+// sets against a pixel by pixel union. Prints the chosen windows and exits
+// with 1 on the first wrong one.
+//
+//   g++ -std=c++17 -O2 -o dirty_check tools/dirty_check.cpp
+//   ./dirty_check
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "../dirty_region.h"
+
+static const LayoutRect widgets[WIDGET_COUNT] = {
+    {0, 0, 400, 14},     // WIDGET_STATUS
+    {0, 14, 400, 18},    // WIDGET_ALERT
+    {0, 40, 144, 80},    // WIDGET_DATE
+    {144, 32, 256, 88},  // WIDGET_INDOOR
+    {0, 120, 400, 36},   // WIDGET_ENV
+    {0, 156, 136, 144},  // WIDGET_OUTDOOR
+    {138, 156, 182, 34}, // WIDGET_SUN
+    {322, 156, 78, 74},  // WIDGET_ICON
+    {322, 232, 78, 68},  // WIDGET_MOON
+};
+
+struct Case
+{
+    const char *name;
+    uint16_t dirty; // bit per Widget
+    bool refresh;
+    LayoutRect window;
+};
+
+static const Case cases[] = {
+    {"nothing changed", 0, false, {}},
+    {"minute tick", 1 << WIDGET_STATUS, true, {0, 0, 400, 14}},
+    {"indoor temperature", 1 << WIDGET_INDOOR, true, {144, 32, 256, 88}},
+    {"minute and temperature", 1 << WIDGET_STATUS | 1 << WIDGET_INDOOR, true, {0, 0, 400, 120}},
+    {"new weather", 1 << WIDGET_OUTDOOR | 1 << WIDGET_ICON, true, {0, 156, 400, 144}},
+    {"icon and moon", 1 << WIDGET_ICON | 1 << WIDGET_MOON, true, {322, 156, 78, 144}},
+    {"new day", (1 << WIDGET_COUNT) - 1, true, {0, 0, 400, 300}},
+};
+
+static bool sameRect(const LayoutRect &a, const LayoutRect &b)
+{
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+// Hashes as the sketch keeps them, a dirty region gets a different one
+static void hashesFor(uint32_t dirty, uint8_t count, uint32_t *hashes, uint32_t *shown)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        shown[i] = 0x811c9dc5u + i;
+        hashes[i] = dirty & (1u << i) ? ~shown[i] : shown[i];
+    }
+}
+
+static bool checkLayout()
+{
+    bool ok = true;
+    uint32_t hashes[WIDGET_COUNT], shown[WIDGET_COUNT];
+    for (const Case &c : cases)
+    {
+        hashesFor(c.dirty, WIDGET_COUNT, hashes, shown);
+        LayoutRect window = {-1, -1, 0, 0};
+        const bool refresh = dirtyWindow(widgets, hashes, shown, WIDGET_COUNT, window);
+        const bool same = refresh == c.refresh && (!refresh || sameRect(window, c.window));
+        if (refresh)
+            printf("%-24s %3d,%3d %3ux%-3u  %s\n", c.name, window.x, window.y, window.w, window.h,
+                   same ? "ok" : "WRONG");
+        else
+            printf("%-24s no refresh       %s\n", c.name, same ? "ok" : "WRONG");
+        ok = ok && same;
+    }
+    return ok;
+}
+
+// The window has to be the smallest box that covers every dirty region
+static bool checkRandom(int runs)
+{
+    const int W = 64, H = 48, COUNT = 12;
+    static bool covered[H][W];
+    srand(1);
+    for (int run = 0; run < runs; run++)
+    {
+        LayoutRect boxes[COUNT];
+        for (LayoutRect &box : boxes)
+        {
+            box.x = rand() % W;
+            box.y = rand() % H;
+            box.w = 1 + rand() % (W - box.x);
+            box.h = 1 + rand() % (H - box.y);
+        }
+        const uint32_t dirty = rand() & ((1u << COUNT) - 1);
+        uint32_t hashes[COUNT], shown[COUNT];
+        hashesFor(dirty, COUNT, hashes, shown);
+
+        memset(covered, 0, sizeof(covered));
+        int x0 = W, y0 = H, x1 = 0, y1 = 0;
+        for (int i = 0; i < COUNT; i++)
+            if (dirty & (1u << i))
+                for (int y = boxes[i].y; y < boxes[i].y + boxes[i].h; y++)
+                    for (int x = boxes[i].x; x < boxes[i].x + boxes[i].w; x++)
+                        covered[y][x] = true;
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+                if (covered[y][x])
+                {
+                    x0 = x < x0 ? x : x0;
+                    y0 = y < y0 ? y : y0;
+                    x1 = x + 1 > x1 ? x + 1 : x1;
+                    y1 = y + 1 > y1 ? y + 1 : y1;
+                }
+
+        LayoutRect window = {};
+        const bool refresh = dirtyWindow(boxes, hashes, shown, COUNT, window);
+        const LayoutRect expected = {(int16_t)x0, (int16_t)y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0)};
+        if (refresh != (dirty != 0) || (refresh && !sameRect(window, expected)))
+        {
+            printf("random run %d, dirty 0x%03x: WRONG\n", run, dirty);
+            return false;
+        }
+    }
+    printf("%d random dirty sets        ok\n", runs);
+    return true;
+}
+
+int main()
+{
+    const bool ok = checkLayout() && checkRandom(10000);
+    return ok ? 0 : 1;
+}
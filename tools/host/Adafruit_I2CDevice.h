@@ -0,0 +1 @@
+// Adafruit_GFX.h includes the BusIO headers, nothing in them is used on the host
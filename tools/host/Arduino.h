@@ -0,0 +1,159 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// The part of the Arduino core the sketch and its libraries use, for the host
+// build in tools/host (see host_main.cpp). Build with -DARDUINO=10819 so the
+// repo headers take their Arduino branches, and with -DHAL_HOST.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include "Print.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// Flash and RTC memory are plain RAM here. RTC_DATA_ATTR variables are kept
+// in their own section, host_main.cpp carries it from one wake to the next.
+#define PROGMEM
+#define RTC_DATA_ATTR __attribute__((section("rtc_data")))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_pointer(addr) (*(void *const *)(addr)) // all 64 bits, Adafruit_GFX would cut it to a dword
+#define memcpy_P memcpy
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+using std::max;
+using std::min;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+inline void yield() {}
+
+class __FlashStringHelper;
+#define F(literal) (reinterpret_cast<const __FlashStringHelper *>(literal))
+
+class String
+{
+public:
+    String(const char *cstr = "") : s(cstr ? cstr : "") {}
+    String(const std::string &str) : s(str) {}
+    explicit String(char c) : s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10) : String((unsigned long)value, base) {}
+    explicit String(int value, unsigned char base = 10) : String((long)value, base) {}
+    explicit String(unsigned int value, unsigned char base = 10) : String((unsigned long)value, base) {}
+    explicit String(long value, unsigned char base = 10)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), base == 16 ? "%lx" : "%ld", value);
+        s = buf;
+    }
+    explicit String(unsigned long value, unsigned char base = 10)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), base == 16 ? "%lx" : "%lu", value);
+        s = buf;
+    }
+    explicit String(float value, unsigned char decimals = 2) : String((double)value, decimals) {}
+    explicit String(double value, unsigned char decimals = 2)
+    {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+        s = buf;
+    }
+
+    const char *c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    char operator[](unsigned int index) const { return index < s.size() ? s[index] : 0; }
+    float toFloat() const { return atof(s.c_str()); }
+    long toInt() const { return atol(s.c_str()); }
+    void trim()
+    {
+        const char *blank = " \t\r\n\f\v";
+        s.erase(s.find_last_not_of(blank) + 1);
+        s.erase(0, std::min(s.find_first_not_of(blank), s.size()));
+    }
+
+    String &operator+=(const String &rhs)
+    {
+        s += rhs.s;
+        return *this;
+    }
+    String &operator+=(const char *rhs)
+    {
+        s += rhs;
+        return *this;
+    }
+    String &operator+=(char c)
+    {
+        s += c;
+        return *this;
+    }
+    friend String operator+(const String &lhs, const String &rhs) { return String(lhs.s + rhs.s); }
+    friend String operator+(const String &lhs, const char *rhs) { return String(lhs.s + rhs); }
+    friend String operator+(const char *lhs, const String &rhs) { return String(lhs + rhs.s); }
+    bool operator==(const String &rhs) const { return s == rhs.s; }
+    bool operator==(const char *rhs) const { return s == rhs; }
+    bool operator!=(const String &rhs) const { return s != rhs.s; }
+    bool operator!=(const char *rhs) const { return s != rhs; }
+
+private:
+    std::string s;
+};
+
+inline size_t Print::print(const String &str)
+{
+    return write(str.c_str());
+}
+
+// glibc has it from 2.38 on
+#if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+inline size_t strlcpy(char *dst, const char *src, size_t size)
+{
+    const size_t len = strlen(src);
+    if (size)
+    {
+        const size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
+
+// Serial goes to stdout
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    using Print::write;
+    void flush() override { fflush(stdout); }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef GXEPD2_H
+#define GXEPD2_H
+
+// Colour values of GxEPD2.h for the host build, the panel is host_panel.h
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+#define GxEPD_DARKGREY 0x7BEF
+#define GxEPD_LIGHTGREY 0xC618
+#define GxEPD_RED 0xF800
+#define GxEPD_YELLOW 0xFFE0
+
+#endif
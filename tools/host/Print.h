@@ -0,0 +1,89 @@
+#ifndef PRINT_H
+#define PRINT_H
+
+// Print of the Arduino core for the host build, the overloads the sketch,
+// Adafruit_GFX and U8g2_for_Adafruit_GFX use.
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+class String;
+class __FlashStringHelper;
+
+#define DEC 10
+#define HEX 16
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+            n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+    size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+    virtual void flush() {}
+
+    size_t print(const __FlashStringHelper *str) { return write((const char *)str); }
+    size_t print(const String &str);
+    size_t print(const char *str) { return write(str); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(long n, int base = DEC)
+    {
+        return base == DEC ? printf("%ld", n) : print((unsigned long)n, base);
+    }
+    size_t print(unsigned long n, int base = DEC)
+    {
+        return printf(base == HEX ? "%lX" : base == 8 ? "%lo" : "%lu", n);
+    }
+    size_t print(double n, int digits = 2) { return printf("%.*f", digits, n); }
+
+    template <typename T>
+    size_t println(const T &value)
+    {
+        size_t n = print(value);
+        return n + println();
+    }
+    template <typename T>
+    size_t println(const T &value, int format)
+    {
+        size_t n = print(value, format);
+        return n + println();
+    }
+    size_t println() { return write("\r\n"); }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        if (len < 0)
+            return 0;
+        if ((size_t)len < sizeof(buf))
+            return write(buf, len);
+
+        // longer than the stack buffer, format again into one that fits
+        char *big = new char[len + 1];
+        va_start(args, format);
+        vsnprintf(big, len + 1, format, args);
+        va_end(args);
+        size_t n = write(big, len);
+        delete[] big;
+        return n;
+    }
+};
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef RTCLIB_H
+#define RTCLIB_H
+
+// DateTime of RTClib for the host build, the clock itself is mocked in
+// hal_host.cpp. Same conversions as the library for 2000 to 2099.
+
+#include <stdint.h>
+
+#define SECONDS_FROM_1970_TO_2000 946684800
+
+class DateTime
+{
+public:
+    DateTime(uint32_t t = SECONDS_FROM_1970_TO_2000)
+    {
+        const uint32_t days = t / 86400;
+        const uint32_t secs = t % 86400;
+        hh = secs / 3600;
+        mm = secs / 60 % 60;
+        ss = secs % 60;
+        wday = (days + 4) % 7; // 1970-01-01 was a Thursday
+
+        // civil date from days since 1970, see H. Hinnant's date algorithms
+        const uint32_t z = days + 719468;
+        const uint32_t era = z / 146097;
+        const uint32_t doe = z - era * 146097;
+        const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const uint32_t mp = (5 * doy + 2) / 153;
+        d = doy - (153 * mp + 2) / 5 + 1;
+        m = mp < 10 ? mp + 3 : mp - 9;
+        y = yoe + era * 400 + (m <= 2);
+    }
+
+    DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t min = 0, uint8_t sec = 0)
+        : DateTime(epoch(year, month, day) + hour * 3600UL + min * 60UL + sec)
+    {
+    }
+
+    uint16_t year() const { return y; }
+    uint8_t month() const { return m; }
+    uint8_t day() const { return d; }
+    uint8_t hour() const { return hh; }
+    uint8_t minute() const { return mm; }
+    uint8_t second() const { return ss; }
+    uint8_t dayOfTheWeek() const { return wday; } // 0 = Sunday
+    uint32_t unixtime() const { return epoch(y, m, d) + hh * 3600UL + mm * 60UL + ss; }
+
+private:
+    uint16_t y;
+    uint8_t m, d, hh, mm, ss, wday;
+
+    // Seconds from 1970 to midnight of a civil date
+    static uint32_t epoch(uint16_t year, uint8_t month, uint8_t day)
+    {
+        const uint32_t yy = year - (month <= 2);
+        const uint32_t era = yy / 400;
+        const uint32_t yoe = yy - era * 400;
+        const uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return (era * 146097 + doe - 719468) * 86400UL;
+    }
+};
+
+#endif
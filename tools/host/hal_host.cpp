@@ -0,0 +1,411 @@
+// Host backend of hal.h: the board's peripherals replaced by mocks, so
+// setup() runs unchanged on a PC (see host_main.cpp). Sensors, battery and
+// light read fixed values from hostConfig, the DS3231 runs on the wall clock
+// from the time host_main.cpp gives it, WiFi connects unless --offline,
+// NVS is a text file and HTTP serves the fixture files through the same
+// HttpExchange the board uses, including 304s and gzip.
+
+#include "hal.h"
+#include <zlib.h>
+#include <map>
+#include <string>
+#include "crc32.h"
+#include "host.h"
+#include "http_exchange.h"
+
+HostConfig hostConfig = {
+    "host_out",                         // outDir
+    "tools/fixtures/onecall_full.json", // owmFile
+    "tools/fixtures/custom.json",       // customFile
+    250.0f,                             // lux
+    23.4f,                              // tempC
+    48.0f,                              // humidity
+    1009.0f,                            // pressure
+    3.3f,                               // battVolts
+    false,                              // offline
+    false,                              // debug
+};
+
+static uint32_t rtcAtBoot; // DS3231 time at the reset
+static uint32_t cpuMhz;
+static bool wifiUp;
+static char wifiSsid[33];
+
+static RTC_DATA_ATTR bool wifiLeaseCached = false; // like the lease hal.cpp keeps across deep sleep
+
+void hostBoot(uint32_t clock)
+{
+    rtcAtBoot = clock;
+    cpuMhz = 240;
+    wifiUp = false;
+    wifiSsid[0] = '\0';
+}
+
+EpdPanel halPanel()
+{
+    return EpdPanel();
+}
+
+//=============== NVS ===============
+// One "key=type:value" line per key in <outDir>/nvs.txt, each wake is a
+// process of its own so every put goes to the file right away
+
+static std::map<std::string, std::string> nvs;
+
+static std::string nvsPath()
+{
+    return std::string(hostConfig.outDir) + "/nvs.txt";
+}
+
+void halNvsBegin()
+{
+    nvs.clear();
+    FILE *f = fopen(nvsPath().c_str(), "r");
+    if (!f)
+        return;
+    char line[512];
+    while (fgets(line, sizeof(line), f))
+    {
+        line[strcspn(line, "\n")] = '\0';
+        char *eq = strchr(line, '=');
+        if (eq)
+            nvs[std::string(line, eq - line)] = eq + 1;
+    }
+    fclose(f);
+}
+
+void halNvsEnd()
+{
+    nvs.clear();
+}
+
+static void nvsPut(const char *key, char type, const std::string &value)
+{
+    nvs[key] = std::string(1, type) + ":" + value;
+    FILE *f = fopen(nvsPath().c_str(), "w");
+    if (!f)
+    {
+        perror(nvsPath().c_str());
+        return;
+    }
+    for (const auto &entry : nvs)
+        fprintf(f, "%s=%s\n", entry.first.c_str(), entry.second.c_str());
+    fclose(f);
+}
+
+// Stored text of a key of the given type, nullptr when there is none
+static const char *nvsGet(const char *key, char type)
+{
+    auto it = nvs.find(key);
+    if (it == nvs.end() || it->second.size() < 2 || it->second[0] != type)
+        return nullptr;
+    return it->second.c_str() + 2;
+}
+
+bool halNvsHas(const char *key)
+{
+    return nvs.count(key) != 0;
+}
+
+bool halNvsGetBool(const char *key, bool fallback)
+{
+    const char *value = nvsGet(key, 'b');
+    return value ? atoi(value) != 0 : fallback;
+}
+
+void halNvsPutBool(const char *key, bool value)
+{
+    nvsPut(key, 'b', value ? "1" : "0");
+}
+
+uint8_t halNvsGetUChar(const char *key, uint8_t fallback)
+{
+    const char *value = nvsGet(key, 'u');
+    return value ? atoi(value) : fallback;
+}
+
+void halNvsPutUChar(const char *key, uint8_t value)
+{
+    nvsPut(key, 'u', std::to_string(value));
+}
+
+float halNvsGetFloat(const char *key, float fallback)
+{
+    const char *value = nvsGet(key, 'f');
+    return value ? strtof(value, nullptr) : fallback;
+}
+
+void halNvsPutFloat(const char *key, float value)
+{
+    char text[24];
+    snprintf(text, sizeof(text), "%.9g", value);
+    nvsPut(key, 'f', text);
+}
+
+String halNvsGetString(const char *key, const char *fallback)
+{
+    const char *value = nvsGet(key, 's');
+    return value ? value : fallback;
+}
+
+void halNvsPutString(const char *key, const char *value)
+{
+    nvsPut(key, 's', value);
+}
+
+//=============== BOARD ===============
+void halSetCpuMhz(uint32_t mhz)
+{
+    cpuMhz = mhz;
+}
+
+uint32_t halCpuMhz()
+{
+    return cpuMhz;
+}
+
+bool halDebugSwitch()
+{
+    return hostConfig.debug;
+}
+
+void halDeepSleep(uint32_t seconds)
+{
+    hostWakeEnd(false, halNow().unixtime(), seconds);
+}
+
+void halRestart()
+{
+    hostWakeEnd(true, halNow().unixtime(), 0);
+}
+
+//=============== TIMING ===============
+int64_t halMicros()
+{
+    return micros();
+}
+
+uint32_t halMinFreeHeap()
+{
+    return 0; // no heap limit on the host
+}
+
+//=============== I2C BUS AND SENSORS ===============
+void halBusBegin() {}
+void halBusEnd() {}
+
+bool halLightBegin()
+{
+    return true;
+}
+
+float halReadLux()
+{
+    return hostConfig.lux;
+}
+
+bool halRtcBegin()
+{
+    return true;
+}
+
+DateTime halNow()
+{
+    return DateTime(rtcAtBoot + (uint32_t)(micros() / 1000000));
+}
+
+void halRtcAdjust(const DateTime &dt)
+{
+    rtcAtBoot = dt.unixtime() - (uint32_t)(micros() / 1000000);
+}
+
+bool halIndoorTempBegin()
+{
+    return true;
+}
+
+bool halReadIndoorTemp(float &tempC)
+{
+    tempC = hostConfig.tempC;
+    return true;
+}
+
+bool halEnvBegin()
+{
+    return true;
+}
+
+bool halReadEnv(float &humidity, float &pressure)
+{
+    humidity = hostConfig.humidity;
+    pressure = hostConfig.pressure;
+    return true;
+}
+
+//=============== ADC ===============
+void halAdcBegin() {}
+
+uint32_t halBatteryMilliVolts()
+{
+    return (uint32_t)(hostConfig.battVolts * 500); // behind the 1/2 divider
+}
+
+//=============== WIFI ===============
+HalWifiResult halWifiConnect(const char *ssid, const char *password)
+{
+    (void)password;
+    if (hostConfig.offline)
+        return HAL_WIFI_FAILED;
+    wifiUp = true;
+    strlcpy(wifiSsid, ssid, sizeof(wifiSsid));
+    const bool cached = wifiLeaseCached;
+    wifiLeaseCached = true;
+    return cached ? HAL_WIFI_CACHED : HAL_WIFI_SCANNED;
+}
+
+bool halWifiConnected()
+{
+    return wifiUp;
+}
+
+int8_t halWifiRssi()
+{
+    return wifiUp ? -58 : 0;
+}
+
+void halWifiSsid(char *out, size_t len)
+{
+    strlcpy(out, wifiSsid, len);
+}
+
+String halWifiLocalIp()
+{
+    return wifiUp ? "192.168.1.50" : "0.0.0.0";
+}
+
+void halWifiOff()
+{
+    wifiUp = false;
+}
+
+String halWifiPortalBegin(const char *apName, const char *page)
+{
+    (void)page;
+    printf("[host] access point %s open\n", apName);
+    return "192.168.4.1";
+}
+
+void halWifiPortalWait()
+{
+    // As if the form was posted from a phone right away
+    halNvsPutString("ssid", "host");
+    halNvsPutString("password", "host");
+    printf("[host] credentials posted to the setup page\n");
+    halRestart();
+}
+
+bool halNtpTime(const char *server, long utcOffset, DateTime &now)
+{
+    (void)server;
+    (void)utcOffset;
+    if (!wifiUp)
+        return false;
+    now = halNow(); // the mocked DS3231 does not drift
+    return true;
+}
+
+//=============== HTTP ===============
+static const char *LAST_MODIFIED = "Fri, 16 Oct 2026 10:00:00 GMT";
+static const size_t SEGMENT = 1436; // TCP payload of one WiFi frame
+
+static bool readFile(const char *path, std::string &data)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        data.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+static std::string gzip(const std::string &raw)
+{
+    z_stream zs = {};
+    deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY);
+    std::string out(deflateBound(&zs, raw.size()) + 32, '\0');
+    zs.next_in = (Bytef *)raw.data();
+    zs.avail_in = raw.size();
+    zs.next_out = (Bytef *)&out[0];
+    zs.avail_out = out.size();
+    deflate(&zs, Z_FINISH);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return out;
+}
+
+// Value of a request header, empty when it was not sent
+static std::string header(const char *request, const char *name)
+{
+    const std::string key = std::string("\r\n") + name + ": ";
+    const char *at = strstr(request, key.c_str());
+    if (!at)
+        return "";
+    at += key.size();
+    return std::string(at, strcspn(at, "\r\n"));
+}
+
+// What a caching web server would answer to the request text
+static std::string respond(const char *host, const char *request)
+{
+    std::string body;
+    const char *file = strstr(host, "openweathermap") ? hostConfig.owmFile : hostConfig.customFile;
+    if (!readFile(file, body))
+        return "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%08x\"", (unsigned)crc32Update(0, (const uint8_t *)body.data(), body.size()));
+    const std::string inm = header(request, "If-None-Match");
+    const std::string ims = header(request, "If-Modified-Since");
+    if (!inm.empty() ? inm == etag : ims == LAST_MODIFIED)
+        return std::string("HTTP/1.1 304 Not Modified\r\nETag: ") + etag + "\r\nConnection: close\r\n\r\n";
+
+    std::string head = std::string("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nETag: ") + etag +
+                       "\r\nLast-Modified: " + LAST_MODIFIED + "\r\n";
+    if (header(request, "Accept-Encoding").find("gzip") != std::string::npos)
+    {
+        body = gzip(body);
+        head += "Content-Encoding: gzip\r\n";
+    }
+    head += "Content-Length: " + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n";
+    return head + body;
+}
+
+void halHttpGetAll(HttpRequest *requests, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        HttpRequest &request = requests[i];
+        HttpExchange exchange;
+        request.latencyUs = 0;
+        request.dnsUs = 0; // no lookups on the host
+        request.dnsSavedUs = 0;
+        if (!exchange.begin(request) || !wifiUp)
+        {
+            request.code = HTTP_ERROR_CONNECTION_REFUSED;
+            continue;
+        }
+
+        const int64_t start = halMicros();
+        char text[640];
+        exchange.requestText(text, sizeof(text));
+        const std::string response = respond(exchange.host(), text);
+        for (size_t at = 0; at < response.size(); at += SEGMENT)
+            if (!exchange.receive((const uint8_t *)response.data() + at, std::min(SEGMENT, response.size() - at)))
+                break;
+        exchange.finish(false);
+        request.latencyUs = halMicros() - start;
+    }
+}
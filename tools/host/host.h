@@ -0,0 +1,39 @@
+#ifndef HOST_H
+#define HOST_H
+
+// Between the mocked HAL (hal_host.cpp) and the wake loop (host_main.cpp)
+// of the host build.
+
+#include <stdint.h>
+
+struct HostConfig
+{
+    const char *outDir;     // PBM files and nvs.txt
+    const char *owmFile;    // body served for api.openweathermap.org
+    const char *customFile; // body served for every other host
+    float lux;              // light level, 0 puts the clock in night mode
+    float tempC;            // TMP117
+    float humidity;         // BME680, %
+    float pressure;         // BME680, hPa
+    float battVolts;        // cell voltage, the ADC sees half of it
+    bool offline;           // WiFi never connects
+    bool debug;             // debug switch jumpered
+};
+
+extern HostConfig hostConfig;
+
+/**
+ * @brief Starts a wake, as the board does after a reset
+ * @param clock DS3231 time (local) at the reset
+ */
+void hostBoot(uint32_t clock);
+
+/**
+ * @brief Ends the wake, called by halDeepSleep() and halRestart(), does not return
+ * @param restart halRestart(), RTC memory is lost
+ * @param clock DS3231 time when the board went down
+ * @param sleepSeconds Timer wakeup, 0 for a restart
+ */
+[[noreturn]] void hostWakeEnd(bool restart, uint32_t clock, uint32_t sleepSeconds);
+
+#endif
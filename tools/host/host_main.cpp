@@ -0,0 +1,246 @@
+// Host build of the weather clock. Runs the sketch's setup() on Linux against
+// the mocked HAL in hal_host.cpp, for a number of wakes in a row: each wake
+// is a forked process, so globals start over like after a reset while the
+// RTC_DATA_ATTR variables (section rtc_data) are carried to the next wake and
+// dropped on a restart. Every panel refresh is written as PBM files, the
+// black plane and the red plane, and the last wake prints perfReport(), the
+// wall time of every phase of the wakes so far.
+//
+// Adafruit_GFX and U8g2_for_Adafruit_GFX come from the Arduino libraries
+// folder, tools/host only stands in for the core, GxEPD2 and RTClib. Built
+// from the repo root with LIBS=~/Arduino/libraries, as one command:
+//
+//   g++ -std=c++17 -O2 -DARDUINO=10819 -DHAL_HOST -Itools/host -I.
+//     -I$LIBS/Adafruit_GFX_Library -I$LIBS/U8g2_for_Adafruit_GFX/src
+//     -o weather_host -x c++ epdWeatherClockV1.ino -x none
+//     astro.cpp custom_record.cpp ghost.cpp http_exchange.cpp inflate_stream.cpp json_stream.cpp packbits.cpp
+//     perf.cpp tools/host/hal_host.cpp tools/host/host_main.cpp
+//     $LIBS/Adafruit_GFX_Library/Adafruit_GFX.cpp $LIBS/U8g2_for_Adafruit_GFX/src/*.cpp
+//     -x c $LIBS/U8g2_for_Adafruit_GFX/src/u8g2_fonts.c -x none -lz
+//   ./weather_host --wakes 8 --out host_out
+//
+// The first wake finds no WiFi credentials and goes through the setup page,
+// which is answered at once. Times are for the PC, not for the ESP32.
+
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "hal.h"
+#include "host.h"
+#include "perf.h"
+
+void setup();
+
+extern "C" char __start_rtc_data[], __stop_rtc_data[];
+
+HardwareSerial Serial;
+
+static std::chrono::steady_clock::time_point bootTime;
+static int wakeNumber;
+static int lastWake;
+static int refreshes; // in this wake
+static int resultFd;  // pipe to the parent
+
+enum WakeEnd : uint8_t
+{
+    WAKE_SLEEP,   // halDeepSleep()
+    WAKE_RESTART, // halRestart()
+    WAKE_IDLE,    // setup() returned, debug mode
+};
+
+struct WakeResult
+{
+    WakeEnd end;
+    uint32_t clock;
+    uint32_t sleepSeconds;
+};
+
+unsigned long micros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long millis()
+{
+    return micros() / 1000;
+}
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Writes one plane as a binary PBM, where a set bit is black (or red)
+static void writePbm(const char *path, const uint8_t *plane, uint16_t width, uint16_t height)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+    {
+        perror(path);
+        return;
+    }
+    fprintf(f, "P4\n%u %u\n", width, height);
+    for (size_t i = 0; i < (size_t)width / 8 * height; i++)
+        fputc(~plane[i] & 0xFF, f); // the panel RAM has bit set = white
+    fclose(f);
+}
+
+void hostPanelShow(const uint8_t *black, const uint8_t *red, uint16_t width, uint16_t height, bool partial)
+{
+    char name[64];
+    if (refreshes++)
+        snprintf(name, sizeof(name), "wake%02d-%d", wakeNumber, refreshes);
+    else
+        snprintf(name, sizeof(name), "wake%02d", wakeNumber);
+    std::string path = std::string(hostConfig.outDir) + "/" + name;
+    writePbm((path + ".pbm").c_str(), black, width, height);
+    writePbm((path + "-red.pbm").c_str(), red, width, height);
+    printf("[host] %s refresh, %s.pbm and %s-red.pbm\n", partial ? "partial" : "full", path.c_str(), path.c_str());
+}
+
+[[noreturn]] static void sendResult(WakeEnd end, uint32_t clock, uint32_t sleepSeconds)
+{
+    if (wakeNumber == lastWake)
+        printf("\n[host] wall time per phase, these wakes in the RTC ring:\n%s", perfReport(true).c_str());
+    fflush(stdout);
+    const WakeResult result = {end, clock, sleepSeconds};
+    if (write(resultFd, &result, sizeof(result)) != sizeof(result) ||
+        write(resultFd, __start_rtc_data, __stop_rtc_data - __start_rtc_data) != __stop_rtc_data - __start_rtc_data)
+        _exit(2);
+    _exit(0);
+}
+
+void hostWakeEnd(bool restart, uint32_t clock, uint32_t sleepSeconds)
+{
+    sendResult(restart ? WAKE_RESTART : WAKE_SLEEP, clock, sleepSeconds);
+}
+
+static bool readAll(int fd, void *out, size_t len)
+{
+    for (size_t got = 0; got < len;)
+    {
+        ssize_t n = read(fd, (char *)out + got, len - got);
+        if (n <= 0)
+            return false;
+        got += n;
+    }
+    return true;
+}
+
+/**
+ * @brief Runs one wake in a child process
+ * @param clock DS3231 time at the reset
+ * @param rtc RTC memory at the reset, replaced with the one at the end of the wake
+ * @param result How the wake ended
+ * @return bool false when the child did not report back
+ */
+static bool runWake(uint32_t clock, std::vector<char> &rtc, WakeResult &result)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+        return false;
+    memcpy(__start_rtc_data, rtc.data(), rtc.size());
+    fflush(stdout);
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        resultFd = fds[1];
+        bootTime = std::chrono::steady_clock::now();
+        hostBoot(clock);
+        setup();
+        sendResult(WAKE_IDLE, halNow().unixtime(), 0);
+    }
+    close(fds[1]);
+    const bool ok = pid > 0 && readAll(fds[0], &result, sizeof(result)) && readAll(fds[0], rtc.data(), rtc.size());
+    close(fds[0]);
+    int status = 0;
+    if (pid > 0)
+        waitpid(pid, &status, 0);
+    return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [--wakes N] [--out DIR] [--start \"YYYY-MM-DD HH:MM\"] [--owm FILE] [--custom FILE]\n"
+            "          [--lux LUX] [--temp C] [--batt VOLTS] [--offline] [--debug]\n",
+            name);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    int wakes = 8;
+    const char *start = "2026-10-16 09:00";
+    for (int i = 1; i < argc; i++)
+    {
+        const bool value = i + 1 < argc;
+        if (!strcmp(argv[i], "--wakes") && value)
+            wakes = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--out") && value)
+            hostConfig.outDir = argv[++i];
+        else if (!strcmp(argv[i], "--start") && value)
+            start = argv[++i];
+        else if (!strcmp(argv[i], "--owm") && value)
+            hostConfig.owmFile = argv[++i];
+        else if (!strcmp(argv[i], "--custom") && value)
+            hostConfig.customFile = argv[++i];
+        else if (!strcmp(argv[i], "--lux") && value)
+            hostConfig.lux = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--temp") && value)
+            hostConfig.tempC = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--batt") && value)
+            hostConfig.battVolts = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--offline"))
+            hostConfig.offline = true;
+        else if (!strcmp(argv[i], "--debug"))
+            hostConfig.debug = true;
+        else
+            usage(argv[0]);
+    }
+
+    // The DS3231 keeps local time
+    struct tm t = {};
+    if (sscanf(start, "%d-%d-%d %d:%d", &t.tm_year, &t.tm_mon, &t.tm_mday, &t.tm_hour, &t.tm_min) != 5)
+        usage(argv[0]);
+    uint32_t clock = DateTime(t.tm_year, t.tm_mon, t.tm_mday, t.tm_hour, t.tm_min, 0).unixtime();
+
+    // Power on: empty NVS, RTC memory as the program starts
+    if (mkdir(hostConfig.outDir, 0755) != 0 && errno != EEXIST)
+    {
+        perror(hostConfig.outDir);
+        return 1;
+    }
+    remove((std::string(hostConfig.outDir) + "/nvs.txt").c_str());
+    const std::vector<char> powerOn(__start_rtc_data, __stop_rtc_data);
+    std::vector<char> rtc = powerOn;
+
+    lastWake = wakes - 1;
+    for (wakeNumber = 0; wakeNumber < wakes; wakeNumber++)
+    {
+        const DateTime now(clock);
+        printf("\n[host] wake %d at %04u-%02u-%02u %02u:%02u:%02u\n", wakeNumber, now.year(), now.month(), now.day(),
+               now.hour(), now.minute(), now.second());
+        WakeResult result;
+        if (!runWake(clock, rtc, result))
+        {
+            fprintf(stderr, "[host] wake %d did not finish\n", wakeNumber);
+            return 1;
+        }
+        if (result.end == WAKE_IDLE)
+        {
+            printf("[host] setup() returned, the board idles in loop() until it is reset\n");
+            break;
+        }
+        if (result.end == WAKE_RESTART)
+            rtc = powerOn; // RTC memory does not survive a restart
+        clock = result.clock + result.sleepSeconds;
+    }
+    return 0;
+}
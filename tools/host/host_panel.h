@@ -0,0 +1,77 @@
+#ifndef HOST_PANEL_H
+#define HOST_PANEL_H
+
+// Stand-in for the GxEPD2 driver of the 4.2" three colour panel on the host.
+// It keeps the two controller RAM planes like the UC8276 (bit set = white,
+// bit set = no red) and hands them to hostPanelShow() on every refresh,
+// host_main.cpp writes them out as PBM files. Same size and update flags as
+// GxEPD2_420c_Z21, so the sketch takes the same paths as on the board.
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Called for every refresh with the whole controller RAM
+ * @param black Black plane, WIDTH / 8 bytes per row, bit set = white
+ * @param red Red plane, bit set = no red
+ * @param partial refresh(x, y, w, h) instead of a full refresh
+ */
+void hostPanelShow(const uint8_t *black, const uint8_t *red, uint16_t width, uint16_t height, bool partial);
+
+class HostPanel
+{
+public:
+    static constexpr uint16_t WIDTH = 400;
+    static constexpr uint16_t HEIGHT = 300;
+    static constexpr bool hasColor = true;
+    static constexpr bool hasPartialUpdate = true;
+    static constexpr bool hasFastPartialUpdate = false;
+
+    void init(uint32_t, bool, uint16_t, bool) { writeScreenBuffer(); }
+
+    void writeScreenBuffer(uint8_t value = 0xFF)
+    {
+        memset(black, value, sizeof(black));
+        memset(red, 0xFF, sizeof(red));
+    }
+
+    /**
+     * @brief Writes a window of both planes, like GxEPD2_420c_Z21::writeImage()
+     * @param bitmapColor Red plane, nullptr leaves no red in the window
+     * @note x and w are widened to whole bytes, the part outside the panel is dropped
+     */
+    void writeImage(const uint8_t *bitmapBlack, const uint8_t *bitmapColor, int16_t x, int16_t y, int16_t w, int16_t h,
+                    bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+        (void)pgm;
+        const int16_t wb = (w + 7) / 8;
+        x -= x % 8;
+        for (int16_t j = 0; j < h; j++)
+        {
+            const int16_t row = y + j;
+            if (row < 0 || row >= HEIGHT)
+                continue;
+            const int16_t src = (mirror_y ? h - 1 - j : j) * wb;
+            for (int16_t i = 0; i < wb; i++)
+            {
+                const int16_t col = x / 8 + i;
+                if (col < 0 || col >= WIDTH / 8)
+                    continue;
+                const uint8_t b = bitmapBlack ? bitmapBlack[src + i] : 0xFF;
+                black[row * (WIDTH / 8) + col] = invert ? ~b : b;
+                red[row * (WIDTH / 8) + col] = bitmapColor ? bitmapColor[src + i] : 0xFF;
+            }
+        }
+    }
+
+    void refresh(bool partial_update_mode = false) { hostPanelShow(black, red, WIDTH, HEIGHT, partial_update_mode); }
+    void refresh(int16_t, int16_t, int16_t, int16_t) { hostPanelShow(black, red, WIDTH, HEIGHT, true); }
+    void hibernate() {}
+    void powerOff() {}
+
+private:
+    uint8_t black[WIDTH / 8 * HEIGHT];
+    uint8_t red[WIDTH / 8 * HEIGHT];
+};
+
+#endif
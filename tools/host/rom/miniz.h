@@ -0,0 +1,122 @@
+#ifndef HOST_ROM_MINIZ_H
+#define HOST_ROM_MINIZ_H
+
+// PC stand-in for the tinfl part of the miniz inflater in the ESP32 ROM, so
+// inflate_stream.cpp builds unchanged for the host tools. The work is done by
+// zlib (link with -lz), timings taken with it are zlib's, not the ROM's.
+//
+// The ROM tinfl reads a few bytes past the end of the deflate data into its
+// bit buffer, and a gzip trailer can start there. This adapter does the same
+// with up to 2 bytes and 3 padding bits, so the code that takes them back
+// out of m_bit_buf is exercised on the PC too. There is one zlib stream for
+// the whole program, reset by every new body, so bodies that are dropped
+// half way leak nothing but only one can be decoded at a time.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+typedef uint8_t mz_uint8;
+typedef uint32_t mz_uint32;
+
+typedef enum
+{
+    TINFL_STATUS_FAILED_CANNOT_MAKE_PROGRESS = -4,
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+enum
+{
+    TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+    TINFL_FLAG_HAS_MORE_INPUT = 2,
+    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+    TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+#define HOST_TINFL_READ_AHEAD 2 // bytes taken past the end of the deflate data
+#define HOST_TINFL_PADDING 3    // unused bits of the last deflate byte
+
+struct tinfl_decompressor
+{
+    mz_uint32 m_state; // 0 before the first call, 1 while inflating, 2 done, 3 failed
+    mz_uint32 m_num_bits;
+    mz_uint32 m_bit_buf;
+};
+
+inline z_stream &hostTinflStream()
+{
+    static z_stream zs;
+    static bool ready = inflateInit2(&zs, -15) == Z_OK;
+    (void)ready;
+    return zs;
+}
+
+#define tinfl_init(r)         \
+    do                        \
+    {                         \
+        (r)->m_state = 0;     \
+        (r)->m_num_bits = 0;  \
+        (r)->m_bit_buf = 0;   \
+    } while (0)
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor *r, const mz_uint8 *pIn_buf_next, size_t *pIn_buf_size,
+                                     mz_uint8 *pOut_buf_start, mz_uint8 *pOut_buf_next, size_t *pOut_buf_size,
+                                     const mz_uint32 decomp_flags)
+{
+    (void)pOut_buf_start; // zlib keeps its own window
+    if (r->m_state >= 2)
+    {
+        *pIn_buf_size = 0;
+        *pOut_buf_size = 0;
+        return r->m_state == 2 ? TINFL_STATUS_DONE : TINFL_STATUS_FAILED;
+    }
+    z_stream &zs = hostTinflStream();
+    if (r->m_state == 0)
+    {
+        if (inflateReset2(&zs, decomp_flags & TINFL_FLAG_PARSE_ZLIB_HEADER ? 15 : -15) != Z_OK)
+            return TINFL_STATUS_BAD_PARAM;
+        r->m_state = 1;
+    }
+
+    zs.next_in = const_cast<Bytef *>(pIn_buf_next);
+    zs.avail_in = *pIn_buf_size;
+    zs.next_out = pOut_buf_next;
+    zs.avail_out = *pOut_buf_size;
+    int ret = inflate(&zs, Z_NO_FLUSH);
+    size_t inUsed = *pIn_buf_size - zs.avail_in;
+    *pOut_buf_size -= zs.avail_out;
+
+    tinfl_status status;
+    if (ret == Z_STREAM_END)
+    {
+        status = TINFL_STATUS_DONE;
+        if (!(decomp_flags & TINFL_FLAG_PARSE_ZLIB_HEADER))
+        {
+            // Read ahead like the ROM, into the bit buffer above the padding bits
+            r->m_num_bits = HOST_TINFL_PADDING;
+            for (int i = 0; i < HOST_TINFL_READ_AHEAD && inUsed < *pIn_buf_size; i++)
+            {
+                r->m_bit_buf |= (mz_uint32)pIn_buf_next[inUsed++] << r->m_num_bits;
+                r->m_num_bits += 8;
+            }
+        }
+    }
+    else if (ret == Z_OK || ret == Z_BUF_ERROR)
+        status = zs.avail_out == 0 ? TINFL_STATUS_HAS_MORE_OUTPUT : TINFL_STATUS_NEEDS_MORE_INPUT;
+    else
+        status = TINFL_STATUS_FAILED; // a bad Adler-32 too, zlib does not tell it apart
+    *pIn_buf_size = inUsed;
+
+    if (status <= TINFL_STATUS_DONE)
+        r->m_state = status == TINFL_STATUS_DONE ? 2 : 3;
+    return status;
+}
+
+#endif
@@ -0,0 +1,324 @@
+// Host check of the conditional requests in http_exchange.h.
+//
+// Runs HttpExchange, the request and response code halHttpGetAll() uses,
+// over plain sockets against a stand-in server on 127.0.0.1. The server
+// sends ETag and Last-Modified with each body, answers 304 without a body
+// when If-None-Match or If-Modified-Since match, gzips when asked and can
+// cut a response short. Checks that validators are captured on a 200, sent
+// back, and that a 304 leaves the sink untouched, that changed content is
+// fetched again, and that cut bodies never come back as 200. Then prints
+// the bytes on the wire for every file given as a plain 200, a gzip 200
+// and a 304, and what the 304 saves. Exits with 1 if a check fails.
+//
+//   g++ -std=c++17 -O2 -Itools/host -o http_check tools/http_check.cpp -lz -pthread
+//   ./http_check tools/fixtures/*.json
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zlib.h>
+
+#include "../http_exchange.cpp"
+#include "../inflate_stream.cpp"
+
+// What the stand-in server has to offer for the next request
+struct Resource
+{
+    std::string body;
+    std::string etag;         // not sent when empty
+    std::string lastModified; // not sent when empty
+    size_t cut;               // body bytes sent before the connection drops, 0 for all of them
+};
+
+// One served exchange, as seen by the server
+struct Served
+{
+    std::string request;
+    int status;
+    size_t wireBytes; // response bytes written, headers included
+};
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what)
+{
+    printf("%-48s %s\n", what, ok ? "ok" : "FAILED");
+    failures += !ok;
+}
+
+static std::string readFile(const char *path)
+{
+    std::string data;
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return data;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        data.append(buf, n);
+    fclose(f);
+    return data;
+}
+
+static std::string gzip(const std::string &raw)
+{
+    z_stream zs = {};
+    deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY);
+    std::string out(deflateBound(&zs, raw.size()) + 32, '\0');
+    zs.next_in = (Bytef *)raw.data();
+    zs.avail_in = raw.size();
+    zs.next_out = (Bytef *)&out[0];
+    zs.avail_out = out.size();
+    deflate(&zs, Z_FINISH);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return out;
+}
+
+// Value of a request header, empty when it was not sent
+static std::string header(const std::string &request, const char *name)
+{
+    const std::string key = std::string("\r\n") + name + ": ";
+    size_t at = request.find(key);
+    if (at == std::string::npos)
+        return "";
+    at += key.size();
+    return request.substr(at, request.find("\r\n", at) - at);
+}
+
+static void writeAll(int fd, const std::string &data)
+{
+    for (size_t sent = 0; sent < data.size();)
+    {
+        ssize_t n = write(fd, data.data() + sent, data.size() - sent);
+        if (n <= 0)
+            return;
+        sent += n;
+    }
+}
+
+// Serves one connection the way a caching web server would
+static void serve(int listener, const Resource &res, Served &served)
+{
+    int fd = accept(listener, nullptr, nullptr);
+    if (fd < 0)
+        return;
+    char buf[1024];
+    ssize_t n;
+    while (served.request.find("\r\n\r\n") == std::string::npos && (n = read(fd, buf, sizeof(buf))) > 0)
+        served.request.append(buf, n);
+
+    // If-None-Match wins over If-Modified-Since, as in RFC 9110
+    const std::string inm = header(served.request, "If-None-Match");
+    const std::string ims = header(served.request, "If-Modified-Since");
+    const bool notModified = !inm.empty() ? inm == res.etag : !ims.empty() && ims == res.lastModified;
+    const bool gzipped = header(served.request, "Accept-Encoding").find("gzip") != std::string::npos;
+
+    std::string body = notModified ? "" : gzipped ? gzip(res.body) : res.body;
+    served.status = notModified ? 304 : 200;
+    std::string head = notModified ? "HTTP/1.1 304 Not Modified\r\n" : "HTTP/1.1 200 OK\r\n";
+    head += "Date: Fri, 16 Oct 2026 12:00:00 GMT\r\nServer: http_check\r\n";
+    if (!res.etag.empty())
+        head += "ETag: " + res.etag + "\r\n";
+    if (!res.lastModified.empty())
+        head += "Last-Modified: " + res.lastModified + "\r\n";
+    if (!notModified)
+    {
+        head += "Content-Type: application/json\r\n";
+        if (gzipped)
+            head += "Content-Encoding: gzip\r\n";
+        head += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+    }
+    head += "Connection: close\r\n\r\n";
+    if (res.cut && res.cut < body.size())
+        body.resize(res.cut);
+    writeAll(fd, head + body);
+    served.wireBytes = head.size() + body.size();
+    close(fd);
+}
+
+static bool collectSink(const uint8_t *data, size_t len, void *ctx)
+{
+    static_cast<std::string *>(ctx)->append((const char *)data, len);
+    return true;
+}
+
+/**
+ * @brief Runs one GET through HttpExchange against the stand-in server
+ * @param res What the server answers with
+ * @param validators Sent and updated like the RTC copy in the sketch
+ * @param compressed Ask for gzip
+ * @param body Out: what reached the sink
+ * @param served Out: the server's side
+ * @return int The code HttpExchange settled on
+ */
+static int fetch(const Resource &res, HttpValidators &validators, bool compressed, std::string &body, Served &served)
+{
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addrLen = sizeof(addr);
+    if (listener < 0 || bind(listener, (sockaddr *)&addr, sizeof(addr)) != 0 || listen(listener, 1) != 0 ||
+        getsockname(listener, (sockaddr *)&addr, &addrLen) != 0)
+    {
+        perror("stand-in server");
+        exit(1);
+    }
+    served = Served();
+    std::thread server(serve, listener, std::cref(res), std::ref(served));
+
+    char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%u/data/3.0/onecall", ntohs(addr.sin_port));
+    HttpRequest request = {};
+    request.url = url;
+    request.sink = collectSink;
+    request.ctx = &body;
+    request.validators = &validators;
+    request.compressed = compressed;
+    body.clear();
+
+    HttpExchange exchange;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (exchange.begin(request) && connect(fd, (sockaddr *)&addr, sizeof(addr)) == 0)
+    {
+        char text[640];
+        writeAll(fd, std::string(text, exchange.requestText(text, sizeof(text))));
+        uint8_t buf[1436]; // TCP payload of one WiFi frame
+        ssize_t n;
+        while ((n = read(fd, buf, sizeof(buf))) > 0 && exchange.receive(buf, n))
+            ;
+        exchange.finish(false);
+    }
+    else
+        request.code = HTTP_ERROR_CONNECTION_REFUSED;
+    close(fd);
+    server.join();
+    close(listener);
+    return request.code;
+}
+
+static void checkConditional()
+{
+    Resource res = {"{\"current\":{\"temp\":14.2}}", "\"v1\"", "Fri, 16 Oct 2026 10:00:00 GMT", 0};
+    HttpValidators v = {};
+    std::string body;
+    Served served;
+
+    int code = fetch(res, v, false, body, served);
+    expect(code == 200 && body == res.body, "first fetch is a 200 with the body");
+    expect(strcmp(v.etag, "\"v1\"") == 0 && strcmp(v.lastModified, res.lastModified.c_str()) == 0,
+           "ETag and Last-Modified captured");
+    expect(header(served.request, "If-None-Match").empty() && header(served.request, "If-Modified-Since").empty(),
+           "no validators sent the first time");
+
+    code = fetch(res, v, false, body, served);
+    expect(header(served.request, "If-None-Match") == "\"v1\"" &&
+               header(served.request, "If-Modified-Since") == res.lastModified,
+           "validators sent back");
+    expect(code == 304 && body.empty() && served.status == 304, "unchanged content is a 304, sink untouched");
+    expect(strcmp(v.etag, "\"v1\"") == 0, "validators kept on a 304");
+
+    res.body = "{\"current\":{\"temp\":15.0}}";
+    res.etag = "\"v2\"";
+    res.lastModified = "Fri, 16 Oct 2026 11:00:00 GMT";
+    code = fetch(res, v, false, body, served);
+    expect(code == 200 && body == res.body && strcmp(v.etag, "\"v2\"") == 0 &&
+               strcmp(v.lastModified, res.lastModified.c_str()) == 0,
+           "changed content is a 200 with new validators");
+
+    // A server without ETag is matched on the date alone
+    res.etag = "";
+    HttpValidators dated = {};
+    fetch(res, dated, false, body, served);
+    code = fetch(res, dated, false, body, served);
+    expect(dated.etag[0] == '\0' && header(served.request, "If-None-Match").empty() && code == 304 && body.empty(),
+           "If-Modified-Since alone gives a 304");
+
+    // Validators of an old response are dropped with the next 200
+    res.lastModified = "";
+    res.etag = "\"v3\"";
+    code = fetch(res, dated, false, body, served);
+    expect(code == 200 && strcmp(dated.etag, "\"v3\"") == 0 && dated.lastModified[0] == '\0',
+           "a 200 replaces all validators");
+}
+
+static void checkCompressed(const std::string &raw)
+{
+    Resource res = {raw, "\"gz\"", "", 0};
+    HttpValidators v = {};
+    std::string body;
+    Served served;
+    int code = fetch(res, v, true, body, served);
+    expect(code == 200 && body == raw && header(served.request, "Accept-Encoding") == "gzip, deflate",
+           "gzip body arrives inflated");
+    code = fetch(res, v, true, body, served);
+    expect(code == 304 && body.empty(), "gzip request revalidates with a 304");
+
+    // Cut bodies, plain and compressed, are never a 200
+    bool refused = true;
+    for (bool compressed : {false, true})
+    {
+        const size_t size = compressed ? gzip(raw).size() : raw.size();
+        for (size_t cut : {(size_t)1, size / 2, size - 1})
+        {
+            HttpValidators none = {};
+            res.cut = cut;
+            refused &= fetch(res, none, compressed, body, served) <= 0;
+        }
+    }
+    expect(refused, "cut bodies end with an error code");
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s file...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<std::pair<std::string, std::string>> files;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string raw = readFile(argv[i]);
+        if (raw.empty())
+        {
+            fprintf(stderr, "%s: cannot read\n", argv[i]);
+            return 1;
+        }
+        const char *slash = strrchr(argv[i], '/');
+        files.push_back({slash ? slash + 1 : argv[i], raw});
+    }
+
+    checkConditional();
+    for (const auto &file : files)
+        checkCompressed(file.second);
+
+    // Bytes on the wire per response, headers included
+    printf("\n%-22s %9s %9s %9s %11s %11s\n", "body", "plain 200", "gzip 200", "304", "saved plain", "saved gzip");
+    for (const auto &file : files)
+    {
+        Resource res = {file.second, "\"5f1c-3a\"", "Fri, 16 Oct 2026 10:00:00 GMT", 0};
+        std::string body;
+        Served plain, gz, notModified;
+        HttpValidators first = {}, v = {};
+        fetch(res, first, false, body, plain);
+        fetch(res, v, true, body, gz);
+        fetch(res, v, true, body, notModified);
+        printf("%-22s %9zu %9zu %9zu %11ld %11ld\n", file.first.c_str(), plain.wireBytes, gz.wireBytes,
+               notModified.wireBytes, (long)plain.wireBytes - (long)notModified.wireBytes,
+               (long)gz.wireBytes - (long)notModified.wireBytes);
+    }
+
+    printf("checks: %s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
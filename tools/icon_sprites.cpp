@@ -0,0 +1,535 @@
+// Host tool that rasterizes the weather icons of icons.h into icon_sprites.h.
+//
+// The icon functions are compiled unchanged against a canvas that repeats the
+// Adafruit_GFX primitives pixel for pixel, so a sprite shows exactly what the
+// primitives would have drawn. Run it again after changing an icon or the icon
+// sizes in layout.h:
+//
+//   g++ -std=c++17 -O2 -o icon_sprites tools/icon_sprites.cpp
+//   ./icon_sprites > icon_sprites.h
+//
+// With --bench it instead times drawing every icon from primitives and from
+// its sprite on the host and counts the pixel writes of both. The sun was no
+// faster as a sprite there, so it gets no bitmaps and the sketch keeps drawing
+// it with iconSun().
+
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+typedef uint8_t byte;
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+#define GxEPD_RED 0xF800
+
+#define PROGMEM
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define HAL_H // icons.h only needs the colours from hal.h
+#include "../icons.h"
+
+#define ICON_SPRITE_SMALL_R 15 // layout.h iconSmallR
+#define ICON_SPRITE_LARGE_S 60 // layout.h iconLargeS
+
+static const int CANVAS_W = 400;
+static const int CANVAS_H = 300;
+
+enum Ink : uint8_t
+{
+    INK_NONE,
+    INK_WHITE,
+    INK_BLACK,
+    INK_RED
+};
+
+// 400x300 three colour frame with the drawing primitives of Adafruit_GFX
+class Canvas
+{
+public:
+    struct Panel
+    {
+        static const bool hasColor = true;
+    } epd2;
+
+    uint8_t ink[CANVAS_H][CANVAS_W];
+    uint32_t pixelWrites;
+
+    void clear()
+    {
+        memset(ink, INK_NONE, sizeof(ink));
+        pixelWrites = 0;
+    }
+
+    // GxEPD2_3C::drawPixel, every colour but black and white ends up red
+    void drawPixel(int16_t x, int16_t y, uint16_t color)
+    {
+        pixelWrites++;
+        if (x < 0 || x >= CANVAS_W || y < 0 || y >= CANVAS_H)
+            return;
+        ink[y][x] = color == GxEPD_WHITE ? INK_WHITE : color == GxEPD_BLACK ? INK_BLACK : INK_RED;
+    }
+
+    void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+
+    void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+    {
+        int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+        if (steep)
+        {
+            std::swap(x0, y0);
+            std::swap(x1, y1);
+        }
+        if (x0 > x1)
+        {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        int16_t dx = x1 - x0;
+        int16_t dy = abs(y1 - y0);
+        int16_t err = dx / 2;
+        int16_t ystep = y0 < y1 ? 1 : -1;
+        for (; x0 <= x1; x0++)
+        {
+            if (steep)
+                writePixel(y0, x0, color);
+            else
+                writePixel(x0, y0, color);
+            err -= dy;
+            if (err < 0)
+            {
+                y0 += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { writeLine(x, y, x, y + h - 1, color); }
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { writeLine(x, y, x + w - 1, y, color); }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+    {
+        if (x0 == x1)
+        {
+            if (y0 > y1)
+                std::swap(y0, y1);
+            drawFastVLine(x0, y0, y1 - y0 + 1, color);
+        }
+        else if (y0 == y1)
+        {
+            if (x0 > x1)
+                std::swap(x0, x1);
+            drawFastHLine(x0, y0, x1 - x0 + 1, color);
+        }
+        else
+            writeLine(x0, y0, x1, y1, color);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        drawFastVLine(x, y, h, color);
+        drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        for (int16_t i = x; i < x + w; i++)
+            drawFastVLine(i, y, h, color);
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+    {
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+
+        writePixel(x0, y0 + r, color);
+        writePixel(x0, y0 - r, color);
+        writePixel(x0 + r, y0, color);
+        writePixel(x0 - r, y0, color);
+
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+
+            writePixel(x0 + x, y0 + y, color);
+            writePixel(x0 - x, y0 + y, color);
+            writePixel(x0 + x, y0 - y, color);
+            writePixel(x0 - x, y0 - y, color);
+            writePixel(x0 + y, y0 + x, color);
+            writePixel(x0 - y, y0 + x, color);
+            writePixel(x0 + y, y0 - x, color);
+            writePixel(x0 - y, y0 - x, color);
+        }
+    }
+
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color)
+    {
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+        int16_t px = x;
+        int16_t py = y;
+
+        delta++;
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (x < (y + 1))
+            {
+                if (corners & 1)
+                    drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+                if (corners & 2)
+                    drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+            }
+            if (y != py)
+            {
+                if (corners & 1)
+                    drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+                if (corners & 2)
+                    drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+    {
+        drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+        fillCircleHelper(x0, y0, r, 3, 0, color);
+    }
+
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+    {
+        int16_t a, b, y, last;
+
+        if (y0 > y1)
+        {
+            std::swap(y0, y1);
+            std::swap(x0, x1);
+        }
+        if (y1 > y2)
+        {
+            std::swap(y2, y1);
+            std::swap(x2, x1);
+        }
+        if (y0 > y1)
+        {
+            std::swap(y0, y1);
+            std::swap(x0, x1);
+        }
+
+        if (y0 == y2)
+        {
+            a = b = x0;
+            if (x1 < a)
+                a = x1;
+            else if (x1 > b)
+                b = x1;
+            if (x2 < a)
+                a = x2;
+            else if (x2 > b)
+                b = x2;
+            drawFastHLine(a, y0, b - a + 1, color);
+            return;
+        }
+
+        int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+
+        last = y1 == y2 ? y1 : y1 - 1;
+        for (y = y0; y <= last; y++)
+        {
+            a = x0 + sa / dy01;
+            b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b)
+                std::swap(a, b);
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+
+        sa = (int32_t)dx12 * (y - y1);
+        sb = (int32_t)dx02 * (y - y0);
+        for (; y <= y2; y++)
+        {
+            a = x1 + sa / dy12;
+            b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b)
+                std::swap(a, b);
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+    }
+
+    // Adafruit_GFX::drawBitmap, transparent background
+    void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+    {
+        int16_t byteWidth = (w + 7) / 8;
+        uint8_t b = 0;
+        for (int16_t j = 0; j < h; j++, y++)
+        {
+            for (int16_t i = 0; i < w; i++)
+            {
+                if (i & 7)
+                    b <<= 1;
+                else
+                    b = bitmap[j * byteWidth + i / 8];
+                if (b & 0x80)
+                    writePixel(x + i, y, color);
+            }
+        }
+    }
+};
+
+struct IconEntry
+{
+    const char *name; // suffix of the enum value and the array names
+    bool large;
+    bool sprite; // false: drawn from primitives, only the enum value is emitted
+    void (*draw)(Canvas &canvas, int16_t x, int16_t y);
+};
+
+// Anchors as used by weatherPrint(), any positive anchor gives the same sprite
+static const int16_t SMALL_X = 361, SMALL_Y = 189;
+static const int16_t LARGE_X = 330, LARGE_Y = 160;
+
+static const IconEntry icons[] = {
+    {"Sun", false, false, [](Canvas &c, int16_t x, int16_t y) { iconSun(c, x, y, ICON_SPRITE_SMALL_R); }},
+    {"Moon", false, true, [](Canvas &c, int16_t x, int16_t y) { iconMoon(c, x, y, ICON_SPRITE_SMALL_R); }},
+    {"Cloud", false, true, [](Canvas &c, int16_t x, int16_t y) { iconCloud(c, x, y, ICON_SPRITE_SMALL_R); }},
+    {"CloudyDay", true, true, [](Canvas &c, int16_t x, int16_t y) { iconCloudyDay(c, x, y, ICON_SPRITE_LARGE_S); }},
+    {"CloudyNight", true, true, [](Canvas &c, int16_t x, int16_t y) { iconCloudyNight(c, x, y, ICON_SPRITE_LARGE_S); }},
+    {"Cloudy", true, true, [](Canvas &c, int16_t x, int16_t y) { iconCloudy(c, x, y, ICON_SPRITE_LARGE_S); }},
+    {"Sleet", true, true, [](Canvas &c, int16_t x, int16_t y) { iconSleet(c, x, y, ICON_SPRITE_LARGE_S); }},
+    {"Rain", true, true, [](Canvas &c, int16_t x, int16_t y) { iconRain(c, x, y, ICON_SPRITE_LARGE_S); }},
+    {"Thunderstorm", true, true, [](Canvas &c, int16_t x, int16_t y) { iconThunderstorm(c, x, y, ICON_SPRITE_LARGE_S); }},
+    {"Snow", true, true, [](Canvas &c, int16_t x, int16_t y) { iconSnow(c, x, y, ICON_SPRITE_LARGE_S); }},
+    {"Fog", true, true, [](Canvas &c, int16_t x, int16_t y) { iconFog(c, x, y, ICON_SPRITE_LARGE_S); }},
+};
+static const size_t ICON_COUNT = sizeof(icons) / sizeof(icons[0]);
+
+struct Sprite
+{
+    int16_t dx, dy, w, h;
+    bool hasRed;
+    uint8_t black[CANVAS_H * CANVAS_W / 8];
+    uint8_t red[CANVAS_H * CANVAS_W / 8];
+};
+
+static Canvas canvas;
+
+// Draws one icon and packs the black and red ink inside its bounding box
+static void rasterize(const IconEntry &icon, Sprite &sprite)
+{
+    int16_t ax = icon.large ? LARGE_X : SMALL_X;
+    int16_t ay = icon.large ? LARGE_Y : SMALL_Y;
+    canvas.clear();
+    icon.draw(canvas, ax, ay);
+
+    int x0 = CANVAS_W, y0 = CANVAS_H, x1 = -1, y1 = -1;
+    for (int y = 0; y < CANVAS_H; y++)
+        for (int x = 0; x < CANVAS_W; x++)
+            if (canvas.ink[y][x] >= INK_BLACK)
+            {
+                x0 = x < x0 ? x : x0;
+                y0 = y < y0 ? y : y0;
+                x1 = x > x1 ? x : x1;
+                y1 = y > y1 ? y : y1;
+            }
+    if (x1 < 0)
+    {
+        fprintf(stderr, "icon %s draws no ink\n", icon.name);
+        exit(1);
+    }
+
+    sprite.dx = x0 - ax;
+    sprite.dy = y0 - ay;
+    sprite.w = x1 - x0 + 1;
+    sprite.h = y1 - y0 + 1;
+    sprite.hasRed = false;
+    int byteWidth = (sprite.w + 7) / 8;
+    memset(sprite.black, 0, sizeof(sprite.black));
+    memset(sprite.red, 0, sizeof(sprite.red));
+    for (int y = 0; y < sprite.h; y++)
+        for (int x = 0; x < sprite.w; x++)
+        {
+            uint8_t ink = canvas.ink[y0 + y][x0 + x];
+            uint8_t bit = 0x80 >> (x & 7);
+            if (ink == INK_BLACK)
+                sprite.black[y * byteWidth + x / 8] |= bit;
+            else if (ink == INK_RED)
+            {
+                sprite.red[y * byteWidth + x / 8] |= bit;
+                sprite.hasRed = true;
+            }
+        }
+}
+
+static void printBytes(const char *name, const uint8_t *data, size_t len)
+{
+    printf("const uint8_t %s[] PROGMEM = {", name);
+    for (size_t i = 0; i < len; i++)
+        printf("%s0x%02x%s", i % 16 ? "" : "\n    ", data[i], i + 1 < len ? "," : "");
+    printf("\n};\n\n");
+}
+
+static void emitHeader()
+{
+    printf("#ifndef ICON_SPRITES_H\n#define ICON_SPRITES_H\n\n");
+    printf("// Generated by tools/icon_sprites.cpp from the icon functions in icons.h, do\n");
+    printf("// not edit. Each weather icon of weatherPrint() as black and red 1bpp bitmaps,\n");
+    printf("// except the ones with nullptr bitmaps, those are drawn from primitives.\n\n");
+    printf("#include \"icons.h\"\n\n");
+    printf("#define ICON_SPRITE_SMALL_R %d // r the small sprites were drawn with\n", ICON_SPRITE_SMALL_R);
+    printf("#define ICON_SPRITE_LARGE_S %d // s the large sprites were drawn with\n\n", ICON_SPRITE_LARGE_S);
+
+    printf("enum IconSpriteId : uint8_t\n{\n");
+    for (size_t i = 0; i < ICON_COUNT; i++)
+    {
+        char upper[32];
+        size_t n = 0;
+        for (const char *p = icons[i].name; *p && n < sizeof(upper) - 2; p++)
+        {
+            if (p != icons[i].name && *p >= 'A' && *p <= 'Z')
+                upper[n++] = '_';
+            upper[n++] = (char)toupper((unsigned char)*p);
+        }
+        upper[n] = '\0';
+        printf("    ICON_SPRITE_%s,\n", upper);
+    }
+    printf("    ICON_SPRITE_COUNT\n};\n\n");
+
+    static Sprite sprites[ICON_COUNT];
+    size_t total = 0;
+    for (size_t i = 0; i < ICON_COUNT; i++)
+    {
+        Sprite &sprite = sprites[i];
+        if (!icons[i].sprite)
+            continue;
+        rasterize(icons[i], sprite);
+        size_t len = ((sprite.w + 7) / 8) * sprite.h;
+        char name[48];
+        snprintf(name, sizeof(name), "sprite%sBlack", icons[i].name);
+        printBytes(name, sprite.black, len);
+        total += len;
+        if (sprite.hasRed)
+        {
+            snprintf(name, sizeof(name), "sprite%sRed", icons[i].name);
+            printBytes(name, sprite.red, len);
+            total += len;
+        }
+    }
+
+    printf("// %zu bytes of bitmaps\n", total);
+    printf("const IconSprite iconSprites[ICON_SPRITE_COUNT] = {\n");
+    for (size_t i = 0; i < ICON_COUNT; i++)
+    {
+        const Sprite &sprite = sprites[i];
+        if (!icons[i].sprite)
+        {
+            printf("    {%s, 0, 0, 0, 0, nullptr, nullptr}, // drawn from primitives\n", icons[i].large ? "true" : "false");
+            continue;
+        }
+        char red[48];
+        if (sprite.hasRed)
+            snprintf(red, sizeof(red), "sprite%sRed", icons[i].name);
+        else
+            snprintf(red, sizeof(red), "nullptr");
+        printf("    {%s, %d, %d, %d, %d, sprite%sBlack, %s},\n", icons[i].large ? "true" : "false",
+               sprite.dx, sprite.dy, sprite.w, sprite.h, icons[i].name, red);
+    }
+    printf("};\n\n#endif\n");
+}
+
+static double nanosPerRun(void (*run)(const IconEntry &, const Sprite &), const IconEntry &icon, const Sprite &sprite)
+{
+    const int runs = 2000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+        run(icon, sprite);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / runs;
+}
+
+static void drawPrimitives(const IconEntry &icon, const Sprite &)
+{
+    icon.draw(canvas, icon.large ? LARGE_X : SMALL_X, icon.large ? LARGE_Y : SMALL_Y);
+}
+
+static void drawSprite(const IconEntry &icon, const Sprite &sprite)
+{
+    int16_t x = (icon.large ? LARGE_X : SMALL_X) + sprite.dx;
+    int16_t y = (icon.large ? LARGE_Y : SMALL_Y) + sprite.dy;
+    canvas.drawBitmap(x, y, sprite.black, sprite.w, sprite.h, GxEPD_BLACK);
+    if (sprite.hasRed)
+        canvas.drawBitmap(x, y, sprite.red, sprite.w, sprite.h, GxEPD_RED);
+}
+
+// Compares both ways of drawing every icon and checks they give the same ink
+static void bench()
+{
+    static Sprite sprite;
+    static uint8_t reference[CANVAS_H][CANVAS_W];
+    printf("%-13s %10s %10s %12s %12s\n", "icon", "prim ns", "sprite ns", "prim writes", "sprite writes");
+    for (size_t i = 0; i < ICON_COUNT; i++)
+    {
+        rasterize(icons[i], sprite);
+        for (int y = 0; y < CANVAS_H; y++)
+            for (int x = 0; x < CANVAS_W; x++)
+                reference[y][x] = canvas.ink[y][x] >= INK_BLACK ? canvas.ink[y][x] : (uint8_t)INK_NONE;
+
+        canvas.clear();
+        drawPrimitives(icons[i], sprite);
+        uint32_t primWrites = canvas.pixelWrites;
+        canvas.clear();
+        drawSprite(icons[i], sprite);
+        uint32_t spriteWrites = canvas.pixelWrites;
+        if (memcmp(reference, canvas.ink, sizeof(reference)) != 0)
+        {
+            fprintf(stderr, "icon %s: sprite differs from the primitives\n", icons[i].name);
+            exit(1);
+        }
+
+        double prim = nanosPerRun(drawPrimitives, icons[i], sprite);
+        double blit = nanosPerRun(drawSprite, icons[i], sprite);
+        printf("%-13s %10.0f %10.0f %12u %12u\n", icons[i].name, prim, blit, primWrites, spriteWrites);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+        bench();
+    else
+        emitHeader();
+    return 0;
+}
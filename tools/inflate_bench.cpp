@@ -0,0 +1,209 @@
+// Host benchmark and check of the compressed HTTP bodies, see inflate_stream.h.
+//
+// Every file given is gzip compressed the way a server would send it, then
+// decoded through InflateStream in network sized pieces, once into a counting
+// sink and once into the JSON extractor the sketch uses. Prints the raw and
+// gzip sizes, the ratio and the time per body. Then checks that damaged
+// bodies (bad CRC, bad length, flipped bits, cut short anywhere) are never
+// reported as done, and exits with 1 if one is.
+//
+// The inflater is zlib behind tools/host/rom/miniz.h, not the ROM tinfl, so
+// the times are for comparing bodies on the PC. The fixtures in
+// tools/fixtures are made up in the One Call 3.0 format, not recorded.
+//
+//   g++ -std=c++17 -O2 -Itools/host -o inflate_bench tools/inflate_bench.cpp -lz
+//   ./inflate_bench tools/fixtures/*.json
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#include "../inflate_stream.cpp"
+#include "../json_stream.cpp"
+
+static const size_t SEGMENT = 1436; // TCP payload of one WiFi frame
+
+static std::vector<uint8_t> readFile(const char *path)
+{
+    std::vector<uint8_t> data;
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return data;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        data.insert(data.end(), buf, buf + n);
+    fclose(f);
+    return data;
+}
+
+// windowBits 31 for gzip, 15 for the zlib wrapper of Content-Encoding: deflate
+static std::vector<uint8_t> compress(const std::vector<uint8_t> &raw, int windowBits)
+{
+    z_stream zs = {};
+    deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY);
+    std::vector<uint8_t> out(deflateBound(&zs, raw.size()) + 32);
+    zs.next_in = const_cast<Bytef *>(raw.data());
+    zs.avail_in = raw.size();
+    zs.next_out = out.data();
+    zs.avail_out = out.size();
+    deflate(&zs, Z_FINISH);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return out;
+}
+
+static bool collectSink(const uint8_t *data, size_t len, void *ctx)
+{
+    static_cast<std::vector<uint8_t> *>(ctx)->insert(static_cast<std::vector<uint8_t> *>(ctx)->end(), data, data + len);
+    return true;
+}
+
+static bool countSink(const uint8_t *, size_t len, void *ctx)
+{
+    *static_cast<size_t *>(ctx) += len;
+    return true;
+}
+
+static void ignoreValue(const char *, const char *, void *) {}
+
+static bool jsonSink(const uint8_t *data, size_t len, void *ctx)
+{
+    return static_cast<JsonStreamExtractor *>(ctx)->feed(data, len);
+}
+
+// Feeds a body in pieces of the given size, true when the stream reported done
+static bool decode(const std::vector<uint8_t> &body, InflateEncoding encoding, size_t piece, HttpBodySink sink,
+                   void *ctx, InflateStream &inflater)
+{
+    if (!inflater.begin(encoding, sink, ctx))
+        return false;
+    for (size_t i = 0; i < body.size(); i += piece)
+        if (!inflater.feed(body.data() + i, std::min(piece, body.size() - i)))
+            break;
+    const bool done = inflater.done();
+    inflater.end();
+    return done;
+}
+
+static double microsPerRun(const std::vector<uint8_t> &body, HttpBodySink sink, void *ctx, bool json)
+{
+    InflateStream inflater;
+    JsonStreamExtractor parser;
+    int runs = std::max<int>(20, (int)(20000000 / (body.size() * 40 + 1)));
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+    {
+        if (json)
+            parser.begin(ignoreValue, nullptr);
+        decode(body, INFLATE_GZIP, SEGMENT, json ? jsonSink : sink, json ? (void *)&parser : ctx, inflater);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / runs;
+}
+
+static double microsPerParse(const std::vector<uint8_t> &raw)
+{
+    JsonStreamExtractor parser;
+    int runs = std::max<int>(20, (int)(20000000 / (raw.size() * 20 + 1)));
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+    {
+        parser.begin(ignoreValue, nullptr);
+        for (size_t j = 0; j < raw.size(); j += SEGMENT)
+            parser.feed(raw.data() + j, std::min(SEGMENT, raw.size() - j));
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / runs;
+}
+
+// Round trips in pieces of every size from 1 byte, then damaged copies
+static int check(const char *name, const std::vector<uint8_t> &raw)
+{
+    int failed = 0;
+    InflateStream inflater;
+    for (int windowBits : {31, 15})
+    {
+        const InflateEncoding encoding = windowBits == 31 ? INFLATE_GZIP : INFLATE_DEFLATE;
+        const std::vector<uint8_t> body = compress(raw, windowBits);
+        for (size_t piece : {(size_t)1, (size_t)2, (size_t)3, (size_t)7, (size_t)64, SEGMENT, body.size()})
+        {
+            std::vector<uint8_t> out;
+            if (!decode(body, encoding, piece, collectSink, &out, inflater) || out != raw)
+            {
+                printf("%s: %s in %zu byte pieces does not round trip\n", name, windowBits == 31 ? "gzip" : "deflate",
+                       piece);
+                failed++;
+            }
+        }
+
+        // Damage must never pass as a complete body with other content. Flips in bits
+        // no decoder reads (FTEXT, MTIME, XFL, OS, the padding of the last deflate
+        // byte) still give the same text
+        size_t accepted = 0, tried = 0;
+        for (size_t cut = 0; cut < body.size(); cut++, tried++)
+        {
+            std::vector<uint8_t> shortBody(body.begin(), body.begin() + cut);
+            std::vector<uint8_t> out;
+            accepted += decode(shortBody, encoding, SEGMENT, collectSink, &out, inflater);
+        }
+        for (size_t bit = 0; bit < body.size() * 8; bit += 1 + body.size() / 512, tried++)
+        {
+            std::vector<uint8_t> bad = body;
+            bad[bit / 8] ^= 1 << (bit & 7);
+            std::vector<uint8_t> out;
+            accepted += decode(bad, encoding, SEGMENT, collectSink, &out, inflater) && out != raw;
+        }
+        if (accepted)
+        {
+            printf("%s: %zu of %zu damaged %s bodies passed as done\n", name, accepted, tried,
+                   windowBits == 31 ? "gzip" : "deflate");
+            failed++;
+        }
+    }
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s file...\n", argv[0]);
+        return 1;
+    }
+
+    printf("%-22s %7s %7s %6s %11s %11s %11s %9s\n", "body", "raw", "gzip", "ratio", "inflate us", "parse us",
+           "both us", "saved");
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> bodies;
+    for (int i = 1; i < argc; i++)
+    {
+        std::vector<uint8_t> raw = readFile(argv[i]);
+        if (raw.empty())
+        {
+            fprintf(stderr, "%s: cannot read\n", argv[i]);
+            return 1;
+        }
+        const char *slash = strrchr(argv[i], '/');
+        bodies.push_back({slash ? slash + 1 : argv[i], raw});
+
+        const std::vector<uint8_t> gz = compress(raw, 31);
+        size_t count = 0;
+        const double inflate = microsPerRun(gz, countSink, &count, false);
+        const double parse = microsPerParse(raw);
+        const double both = microsPerRun(gz, nullptr, nullptr, true);
+        printf("%-22s %7zu %7zu %6.2f %11.1f %11.1f %11.1f %8ld\n", bodies.back().first.c_str(), raw.size(), gz.size(),
+               (double)gz.size() / raw.size(), inflate, parse, both, (long)raw.size() - (long)gz.size());
+    }
+
+    int failed = 0;
+    for (const auto &body : bodies)
+        failed += check(body.first.c_str(), body.second);
+    printf("checks: %s\n", failed ? "FAILED" : "ok");
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,187 @@
+// Host tool that packs the full screen images in resources/ into packed_images.h.
+//
+// Each argument is a binary PBM (P4), the array is named after the file. The
+// pixels are stored the way the panel RAM wants them (1 = white, rows padded
+// to whole bytes with white) and PackBits compressed, see packbits.h for the
+// reader. Run it again after changing or adding an image:
+//
+//   g++ -std=c++17 -O2 -o pack_images tools/pack_images.cpp
+//   ./pack_images resources/nightMode.pbm resources/alert.pbm > packed_images.h
+//
+// With --check it instead unpacks every image again, compares it with the
+// PBM and prints the raw and packed sizes.
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Image
+{
+    std::string name; // file name without directory and extension
+    int w, h;
+    std::vector<uint8_t> bits;   // panel format, 1 = white
+    std::vector<uint8_t> packed; // PackBits
+};
+
+static int pbmNumber(FILE *f)
+{
+    int c = fgetc(f);
+    while (c == '#' || isspace(c))
+    {
+        if (c == '#')
+            while (c != '\n' && c != EOF)
+                c = fgetc(f);
+        c = fgetc(f);
+    }
+    int value = 0;
+    while (isdigit(c))
+    {
+        value = value * 10 + c - '0';
+        c = fgetc(f);
+    }
+    return value; // the single whitespace after the number is consumed
+}
+
+static bool readPbm(const char *path, Image &image)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f || fgetc(f) != 'P' || fgetc(f) != '4')
+    {
+        fprintf(stderr, "%s: not a binary PBM\n", path);
+        return false;
+    }
+    image.w = pbmNumber(f);
+    image.h = pbmNumber(f);
+    const int rowBytes = (image.w + 7) / 8;
+    image.bits.resize(rowBytes * image.h);
+    const bool complete = fread(image.bits.data(), 1, image.bits.size(), f) == image.bits.size();
+    fclose(f);
+    if (!complete || !image.w || !image.h)
+    {
+        fprintf(stderr, "%s: truncated\n", path);
+        return false;
+    }
+    // PBM is 1 = black, the panel 1 = white
+    const uint8_t pad = image.w % 8 ? 0xff >> (image.w % 8) : 0;
+    for (size_t i = 0; i < image.bits.size(); i++)
+        image.bits[i] = ~image.bits[i] | ((i + 1) % rowBytes ? 0 : pad);
+
+    std::string name = path;
+    name = name.substr(name.find_last_of('/') + 1);
+    image.name = name.substr(0, name.find('.'));
+    return true;
+}
+
+// Runs of two or more equal bytes become repeat runs, everything else is
+// gathered into literal runs, both at most 128 bytes
+static std::vector<uint8_t> packBits(const std::vector<uint8_t> &in)
+{
+    std::vector<uint8_t> out;
+    size_t i = 0;
+    while (i < in.size())
+    {
+        size_t run = 1;
+        while (i + run < in.size() && run < 128 && in[i + run] == in[i])
+            run++;
+        if (run >= 2)
+        {
+            out.push_back(uint8_t(1 - run));
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+        size_t literal = 1;
+        while (i + literal < in.size() && literal < 128 &&
+               !(i + literal + 1 < in.size() && in[i + literal] == in[i + literal + 1]))
+            literal++;
+        out.push_back(uint8_t(literal - 1));
+        out.insert(out.end(), in.begin() + i, in.begin() + i + literal);
+        i += literal;
+    }
+    return out;
+}
+
+static std::vector<uint8_t> unpackBits(const std::vector<uint8_t> &in)
+{
+    std::vector<uint8_t> out;
+    for (size_t i = 0; i < in.size();)
+    {
+        const int8_t n = in[i++];
+        if (n == -128)
+            continue;
+        if (n < 0)
+        {
+            out.insert(out.end(), 1 - n, in[i++]);
+        }
+        else
+        {
+            out.insert(out.end(), in.begin() + i, in.begin() + i + n + 1);
+            i += n + 1;
+        }
+    }
+    return out;
+}
+
+static void printBytes(const char *name, const uint8_t *data, size_t len)
+{
+    printf("const uint8_t %s[] PROGMEM = {", name);
+    for (size_t i = 0; i < len; i++)
+        printf("%s0x%02x%s", i % 16 ? "" : "\n    ", data[i], i + 1 < len ? "," : "");
+    printf("\n};\n\n");
+}
+
+static void emitHeader(const std::vector<Image> &images)
+{
+    printf("#ifndef PACKED_IMAGES_H\n#define PACKED_IMAGES_H\n\n");
+    printf("// Generated by tools/pack_images.cpp from the PBM files in resources/, do\n");
+    printf("// not edit. Full screen images, PackBits compressed, read with PackBitsReader.\n\n");
+    printf("#include \"packbits.h\"\n\n");
+    for (const Image &image : images)
+    {
+        const std::string bytes = image.name + "Packed";
+        printBytes(bytes.c_str(), image.packed.data(), image.packed.size());
+        printf("constexpr PackedImage %s = {%d, %d, %zu, %s}; // %zu bytes unpacked\n\n",
+               image.name.c_str(), image.w, image.h, image.packed.size(), bytes.c_str(), image.bits.size());
+    }
+    printf("#endif\n");
+}
+
+static int check(const std::vector<Image> &images)
+{
+    int failed = 0;
+    for (const Image &image : images)
+    {
+        const bool same = unpackBits(image.packed) == image.bits;
+        printf("%-12s %4dx%-4d raw %6zu  packed %6zu  %s\n", image.name.c_str(), image.w, image.h,
+               image.bits.size(), image.packed.size(), same ? "ok" : "MISMATCH");
+        failed += !same;
+    }
+    return failed ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    const bool checkOnly = argc > 1 && strcmp(argv[1], "--check") == 0;
+    std::vector<Image> images;
+    for (int i = checkOnly ? 2 : 1; i < argc; i++)
+    {
+        Image image;
+        if (!readPbm(argv[i], image))
+            return 1;
+        image.packed = packBits(image.bits);
+        if (image.packed.size() > 0xffff)
+        {
+            fprintf(stderr, "%s: too large\n", argv[i]);
+            return 1;
+        }
+        images.push_back(image);
+    }
+    if (checkOnly)
+        return check(images);
+    emitHeader(images);
+    return 0;
+}